@@ -5,6 +5,7 @@ include(CMakeFindDependencyMacro)
 find_dependency(SDL2)
 find_dependency(EnTT)
 find_dependency(glm)
+find_dependency(Threads)
 
 include("${CMAKE_CURRENT_LIST_DIR}/LibraryTargets.cmake")
 
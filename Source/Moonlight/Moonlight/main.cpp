@@ -1,12 +1,20 @@
 #include "Starlight/Platform/Window.hpp"
 #include "Starlight/Runtime/Application.hpp"
 
-auto Star::AppMain([[maybe_unused]] std::span<const char*> args) -> std::unique_ptr<Main>
+auto Star::AppMain(std::span<const char*> args) -> std::unique_ptr<Main>
 {
 	auto app = std::make_unique<Application>();
 
+	// Headless runs simulate as fast as possible without a window.
+	if (Main::HeadlessRequested(args))
+		return app;
+
+	app->TargetFrameRate(144); // NOLINT(*-magic-numbers)
+	app->Threaded(true);
+
 	// NOLINTNEXTLINE(*-magic-numbers)
-	app->Entities().CreateSingleton<Window>("Moonlight", glm::ivec2{1600, 900}, 0);
+	auto& window = app->Entities().CreateSingleton<Window>("Moonlight", glm::ivec2{1600, 900}, 0);
+	window.BatchListener(app.get());
 
 	return app;
 }
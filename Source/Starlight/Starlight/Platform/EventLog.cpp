@@ -0,0 +1,182 @@
+#include "EventLog.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace
+{
+	using namespace Star;
+
+	constexpr std::uint32_t LogMagic = 0x4C455453; // NOLINT(*-magic-numbers) "STEL"
+	constexpr std::uint32_t LogVersion = 2;
+
+	/// Record type of frame markers, event records use the index of their arguments in the variant instead.
+	constexpr std::uint8_t FrameMarker = 0xFF;
+
+	static_assert(std::variant_size_v<WindowEventArgs> < FrameMarker);
+
+	template <typename TType>
+	auto Write(std::ofstream& stream, const TType& value) -> void
+	{
+		static_assert(std::is_trivially_copyable_v<TType>);
+
+		// NOLINTNEXTLINE(*-reinterpret-cast)
+		stream.write(reinterpret_cast<const char*>(&value), sizeof(TType));
+	}
+} //namespace
+
+namespace Star
+{
+	EventRecorder::EventRecorder(const std::filesystem::path& path) :
+		m_Stream{path, std::ios::binary | std::ios::trunc}
+	{
+		if (!m_Stream)
+			throw FileException{"Opening failed for " + path.string()};
+
+		Write(m_Stream, LogMagic);
+		Write(m_Stream, LogVersion);
+	}
+
+	auto EventRecorder::BeginFrame(std::uint32_t timestamp, double delta) -> void
+	{
+		Write(m_Stream, FrameMarker);
+		Write(m_Stream, m_Frame++);
+		Write(m_Stream, timestamp);
+		Write(m_Stream, delta);
+	}
+
+	auto EventRecorder::Record(const WindowEvent& event) -> void
+	{
+		Write(m_Stream, static_cast<std::uint8_t>(event.Args.index()));
+		Write(m_Stream, event.WindowId);
+		Write(m_Stream, event.Timestamp);
+
+		std::visit(
+			[&]<typename TArgs>(const TArgs& args) {
+				if constexpr (std::is_same_v<TArgs, TextInputEventArgs>)
+				{
+					auto length = static_cast<std::uint8_t>(std::ranges::find(event.Text, '\0') - event.Text.begin());
+					Write(m_Stream, length);
+					m_Stream.write(event.Text.data(), length);
+				}
+				else
+					Write(m_Stream, args);
+			},
+			event.Args
+		);
+	}
+
+	template <typename TType>
+	auto EventReplay::Read() -> TType
+	{
+		auto data = m_File.Data();
+		if (data.size() - m_Offset < sizeof(TType))
+			throw EventLogException{"Event log is truncated"};
+
+		TType value{};
+		std::memcpy(&value, data.data() + m_Offset, sizeof(TType));
+		m_Offset += sizeof(TType);
+
+		return value;
+	}
+
+	template <typename TArgs>
+	auto EventReplay::ReadArgs(WindowEvent& event) -> void
+	{
+		if constexpr (std::is_same_v<TArgs, TextInputEventArgs>)
+		{
+			auto length = Read<std::uint8_t>();
+			auto data = m_File.Data();
+
+			if (length >= event.Text.size() || data.size() - m_Offset < length)
+				throw EventLogException{"Event log is corrupted"};
+
+			std::memcpy(event.Text.data(), data.data() + m_Offset, length);
+			m_Offset += length;
+
+			event.Args = TextInputEventArgs{};
+		}
+		else
+			event.Args = Read<TArgs>();
+	}
+
+	EventReplay::EventReplay(const std::filesystem::path& path) :
+		m_File{path}
+	{
+		if (Read<std::uint32_t>() != LogMagic || Read<std::uint32_t>() != LogVersion)
+			throw EventLogException{"Event log format is not supported"};
+
+		m_FirstTimestamp = PeekTimestamp();
+	}
+
+	auto EventReplay::Step() -> bool
+	{
+		if (Done())
+			return false;
+
+		if (Read<std::uint8_t>() != FrameMarker)
+			throw EventLogException{"Event log is corrupted"};
+
+		Read<std::uint64_t>();
+		Read<std::uint32_t>();
+		m_FrameDelta = Read<double>();
+
+		while (!Done() && m_File.Data()[m_Offset] != std::byte{FrameMarker})
+		{
+			auto type = Read<std::uint8_t>();
+
+			WindowEvent event{};
+			event.WindowId = Read<std::uint32_t>();
+			event.Timestamp = Read<std::uint32_t>();
+
+			auto valid = [&]<std::size_t... TIndices>(std::index_sequence<TIndices...>) {
+				auto read = [&]<std::size_t TIndex>() {
+					ReadArgs<std::variant_alternative_t<TIndex, WindowEventArgs>>(event);
+					return true;
+				};
+
+				return ((type == TIndices && read.template operator()<TIndices>()) || ...);
+			}(std::make_index_sequence<std::variant_size_v<WindowEventArgs>>{});
+
+			if (!valid)
+				throw EventLogException{"Event log is corrupted"};
+
+			Window::Dispatch(event);
+		}
+
+		return true;
+	}
+
+	auto EventReplay::Done() const -> bool
+	{
+		return m_Offset >= m_File.Data().size();
+	}
+
+	auto EventReplay::NextFrameTime() const -> std::uint32_t
+	{
+		return PeekTimestamp() - m_FirstTimestamp;
+	}
+
+	auto EventReplay::FrameDelta() const -> double
+	{
+		return m_FrameDelta;
+	}
+
+	auto EventReplay::PeekTimestamp() const -> std::uint32_t
+	{
+		// Frame markers are followed by the frame index and the timestamp.
+		auto data = m_File.Data();
+		auto offset = m_Offset + sizeof(std::uint8_t) + sizeof(std::uint64_t);
+
+		if (Done() || offset > data.size() || data.size() - offset < sizeof(std::uint32_t))
+			return m_FirstTimestamp;
+
+		std::uint32_t timestamp{};
+		std::memcpy(&timestamp, data.data() + offset, sizeof(timestamp));
+		return timestamp;
+	}
+} //namespace Star
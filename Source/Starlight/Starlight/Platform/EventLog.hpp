@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Starlight/Platform/EventQueue.hpp"
+#include "Starlight/Platform/MappedFile.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+namespace Star
+{
+	/// @brief Exception raised when an event log specific error happens.
+	struct EventLogException : std::runtime_error
+	{
+		using runtime_error::runtime_error;
+	};
+
+	/// @brief Writer of binary logs of translated window events.
+	/// @details Every frame starts with a marker holding the frame index, timestamp and update delta, followed by the
+	/// events delivered during that frame. Each event is stored as its type, window ID, timestamp and raw arguments,
+	/// text input as its length and bytes. Logs are only compatible with builds using the same event layouts.
+	class EventRecorder
+	{
+	public:
+		/// @brief Create a log file.
+		/// @param path Path of the file, replaced if it exists.
+		/// @throws FileException If the file cannot be created.
+		explicit EventRecorder(const std::filesystem::path& path);
+
+		/// @brief Start the next frame.
+		/// @param timestamp Time in milliseconds since platform initialisation.
+		/// @param delta Seconds passed to the update of the frame.
+		auto BeginFrame(std::uint32_t timestamp, double delta) -> void;
+
+		/// @brief Append an event to the current frame.
+		/// @param event Event to append.
+		auto Record(const WindowEvent& event) -> void;
+
+	private:
+		std::ofstream m_Stream;
+		std::uint64_t m_Frame{};
+	};
+
+	/// @brief Replay of a binary event log.
+	/// @details Events are dispatched to the windows with the recorded IDs, which match as long as the replaying
+	/// application creates its windows in the same order as the recording one.
+	class EventReplay
+	{
+	public:
+		/// @brief Map a log file.
+		/// @param path Path of the file.
+		/// @throws FileException If the file cannot be mapped.
+		/// @throws EventLogException If the file is not a valid event log.
+		explicit EventReplay(const std::filesystem::path& path);
+
+		/// @brief Dispatch the events of the next frame.
+		/// @return @c true if a frame was replayed, @c false if the log has been replayed completely.
+		/// @throws EventLogException If the log is truncated.
+		auto Step() -> bool;
+
+		/// @brief Check if the log has been replayed completely.
+		/// @return @c true if done, @c false otherwise.
+		[[nodiscard]] auto Done() const -> bool;
+
+		/// @brief Get the time of the next frame relative to the first one.
+		/// @return Recorded milliseconds between the start of the first frame and the next frame.
+		[[nodiscard]] auto NextFrameTime() const -> std::uint32_t;
+
+		/// @brief Get the update delta of the latest replayed frame.
+		/// @return Seconds passed to the update of the frame when it was recorded.
+		[[nodiscard]] auto FrameDelta() const -> double;
+
+	private:
+		template <typename TType>
+		auto Read() -> TType;
+
+		template <typename TArgs>
+		auto ReadArgs(WindowEvent& event) -> void;
+
+		[[nodiscard]] auto PeekTimestamp() const -> std::uint32_t;
+
+		MappedFile m_File;
+		std::size_t m_Offset{};
+		std::uint32_t m_FirstTimestamp{};
+		double m_FrameDelta{};
+	};
+} //namespace Star
@@ -0,0 +1,44 @@
+#include "EventQueue.hpp"
+
+#include <thread>
+
+namespace Star
+{
+	EventQueue::EventQueue() :
+		m_Events{std::make_unique<std::array<WindowEvent, Capacity>>()}
+	{
+	}
+
+	auto EventQueue::Push(const WindowEvent& event) -> bool
+	{
+		auto tail = m_Tail.load(std::memory_order_relaxed);
+
+		while (tail - m_Head.load(std::memory_order_acquire) == Capacity)
+		{
+			if (m_Closed.load(std::memory_order_acquire))
+				return false;
+
+			std::this_thread::yield();
+		}
+
+		(*m_Events)[tail % Capacity] = event;
+		m_Tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	auto EventQueue::Pop(WindowEvent& event) -> bool
+	{
+		auto head = m_Head.load(std::memory_order_relaxed);
+		if (head == m_Tail.load(std::memory_order_acquire))
+			return false;
+
+		event = (*m_Events)[head % Capacity];
+		m_Head.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	auto EventQueue::Close() -> void
+	{
+		m_Closed.store(true, std::memory_order_release);
+	}
+} //namespace Star
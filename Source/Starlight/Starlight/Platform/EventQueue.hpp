@@ -0,0 +1,101 @@
+#pragma once
+
+#include "Starlight/Platform/Window.hpp"
+#include "Starlight/Runtime/Job.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <variant>
+
+namespace Star
+{
+	/// @brief Arguments of any window event.
+	using WindowEventArgs = std::variant<
+		WindowCloseEventArgs,
+		WindowResizeEventArgs,
+		MouseFocusChancedEventArgs,
+		KeyboardFocusChancedEventArgs,
+		KeyboardEventArgs,
+		MouseButtonEventArgs,
+		MouseMotionEventArgs,
+		MouseScrollEventArgs,
+		TextInputEventArgs>;
+
+	/// @brief Translated platform event waiting to be delivered to its window.
+	struct WindowEvent
+	{
+		/// @brief Maximum size in bytes of queued text input, including the null terminator.
+		static constexpr std::size_t TextSize = 32;
+
+		/// @brief ID of the window receiving the event.
+		std::uint32_t WindowId{};
+
+		/// @brief Time in milliseconds since platform initialisation at which the event was raised.
+		std::uint32_t Timestamp{};
+
+		/// @brief Event arguments.
+		/// @details Text input arguments are left empty, the text is stored in @c Text instead.
+		WindowEventArgs Args{};
+
+		/// @brief Null terminated UTF-8 text of text input events.
+		std::array<char, TextSize> Text{};
+	};
+
+	/// @brief Bounded lock-free queue handing window events from one producer thread to one consumer thread.
+	/// @details Used to pump platform events on the platform thread while the simulation drains them once per tick
+	/// on its own thread. Producer and consumer positions live on separate cache lines.
+	class EventQueue
+	{
+	public:
+		/// @brief Maximum number of queued events, a power of two.
+		static constexpr std::size_t Capacity = 4096;
+
+		/// @brief Create an empty queue.
+		EventQueue();
+
+		/// @brief Destructor.
+		~EventQueue() = default;
+
+		/// @brief Copy constructor.
+		/// @param other Queue to copy from.
+		EventQueue(const EventQueue& other) = delete;
+
+		/// @brief Move constructor.
+		/// @param other Queue to move from.
+		EventQueue(EventQueue&& other) = delete;
+
+		/// @brief Copy operator.
+		/// @param other Queue to copy from.
+		/// @return Reference to the current queue.
+		auto operator=(const EventQueue& other) -> EventQueue& = delete;
+
+		/// @brief Move operator.
+		/// @param other Queue to move from.
+		/// @return Reference to the current queue.
+		auto operator=(EventQueue&& other) -> EventQueue& = delete;
+
+		/// @brief Append an event, waiting for the consumer while the queue is full.
+		/// @details Must only be called by the producer thread.
+		/// @param event Event to append.
+		/// @return @c true if the event was appended, @c false if the queue has been closed.
+		auto Push(const WindowEvent& event) -> bool;
+
+		/// @brief Remove the oldest event.
+		/// @details Must only be called by the consumer thread.
+		/// @param event Receives the removed event.
+		/// @return @c true if an event was removed, @c false if the queue is empty.
+		auto Pop(WindowEvent& event) -> bool;
+
+		/// @brief Stop accepting events, so the producer does not wait for a consumer that stopped draining.
+		auto Close() -> void;
+
+	private:
+		std::unique_ptr<std::array<WindowEvent, Capacity>> m_Events;
+		alignas(CacheLineSize) std::atomic<std::size_t> m_Head{};
+		alignas(CacheLineSize) std::atomic<std::size_t> m_Tail{};
+		std::atomic<bool> m_Closed{};
+	};
+} //namespace Star
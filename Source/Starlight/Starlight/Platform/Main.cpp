@@ -1,18 +1,120 @@
 #include "Main.hpp"
 
+#include "Starlight/Platform/EventLog.hpp"
+#include "Starlight/Platform/EventQueue.hpp"
 #include "Starlight/Platform/Window.hpp"
 
 #include <SDL2/SDL.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <cstdlib>
+#include <iterator>
+#include <optional>
+#include <string_view>
+#include <thread>
+#include <utility>
 
 #define NOOP ((void)0)
 
+namespace
+{
+	using namespace Star;
+
+	using Clock = std::chrono::steady_clock;
+
+	/// Sleep granularity is coarse on some platforms, so the last stretch is spent yielding instead.
+	constexpr auto SpinDuration = std::chrono::milliseconds{2};
+
+	constexpr auto TickReportInterval = std::chrono::seconds{1};
+
+	/// Bounds how long the platform thread takes to notice that the simulation thread has stopped.
+	constexpr int EventWaitTimeout = 10;
+
+	auto WaitUntil(Clock::time_point deadline) -> void
+	{
+		if (auto now = Clock::now(); deadline - now > SpinDuration)
+			std::this_thread::sleep_until(deadline - SpinDuration);
+
+		while (Clock::now() < deadline)
+			std::this_thread::yield();
+	}
+
+	[[nodiscard]] auto OptionValue(std::span<const char*> args, std::string_view option) -> const char*
+	{
+		auto arg = std::ranges::find_if(args, [&](std::string_view value) { return value == option; });
+		return arg != args.end() && std::next(arg) != args.end() ? *std::next(arg) : nullptr;
+	}
+
+	/// Events keep arriving while draining, so a flood is bounded to one queue worth per call.
+	auto DispatchQueued(EventQueue& events, EventRecorder* recorder) -> void
+	{
+		WindowEvent event{};
+		for (std::size_t i = 0; i < EventQueue::Capacity && events.Pop(event); ++i)
+		{
+			if (recorder != nullptr)
+				recorder->Record(event);
+
+			Window::Dispatch(event);
+		}
+	}
+
+	/// Returns @c false if the event requests to quit.
+	auto HandleEvent(const SDL_Event& event) -> bool
+	{
+		switch (event.type)
+		{
+		case SDL_QUIT:
+			return false;
+
+		case SDL_WINDOWEVENT:
+			Window::HandleEvent(event.window);
+			break;
+
+		case SDL_KEYUP:
+		case SDL_KEYDOWN:
+			Window::HandleEvent(event.key);
+			break;
+
+		case SDL_MOUSEBUTTONUP:
+		case SDL_MOUSEBUTTONDOWN:
+			Window::HandleEvent(event.button);
+			break;
+
+		case SDL_MOUSEMOTION:
+			Window::HandleEvent(event.motion);
+			break;
+
+		case SDL_MOUSEWHEEL:
+			Window::HandleEvent(event.wheel);
+			break;
+
+		case SDL_TEXTINPUT:
+			Window::HandleEvent(event.text);
+			break;
+		}
+
+		return true;
+	}
+} //namespace
+
 auto main(int argc, char* argv[]) -> int
 {
 	using namespace Star;
 
-	if (SDL_Init(SDL_INIT_VIDEO) < 0)
+	// NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+	auto args = std::span{const_cast<const char**>(argv), static_cast<size_t>(argc)};
+	auto headless = Main::HeadlessRequested(args);
+	const auto* replay = OptionValue(args, "--replay");
+
+	// Replays run without a display, but still create their windows to dispatch the recorded events to.
+	if (replay != nullptr)
+		SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+
+	// Video is initialised once the application entry point has had the chance to request headless mode.
+	if (SDL_Init(0) < 0)
 	{
 		NOOP; // TODO: Log[Fatal] {{SDL_Init}} failed: {SDL_GetError()}
 		return EXIT_FAILURE;
@@ -21,27 +123,192 @@ auto main(int argc, char* argv[]) -> int
 	if (std::atexit(SDL_Quit) != 0)
 		NOOP; // TODO: Log[Warn] {{SDL_Quit}} will not be called at exit
 
-	// NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-	auto appMain = AppMain(std::span{const_cast<const char**>(argv), static_cast<size_t>(argc)});
+	auto appMain = AppMain(args);
 	if (!appMain)
 	{
 		NOOP; // TODO: Log[Fatal] {{AppMain}} returned no main instance
 		return EXIT_FAILURE;
 	}
 
-	while (!appMain->ExitRequested())
-	{
-		if (!Main::ProcessEvents())
-			appMain->RequestExit(EXIT_SUCCESS);
+	if (headless)
+		appMain->Headless(true);
 
-		appMain->Update();
+	if (!appMain->Headless() && SDL_InitSubSystem(SDL_INIT_VIDEO) < 0)
+	{
+		NOOP; // TODO: Log[Fatal] {{SDL_InitSubSystem}} failed: {SDL_GetError()}
+		return EXIT_FAILURE;
 	}
 
-	return appMain->ExitCode();
+	if (const auto* record = OptionValue(args, "--record"))
+		appMain->Record(record);
+
+	if (replay != nullptr)
+		appMain->Replay(replay, std::ranges::none_of(args, [](std::string_view arg) { return arg == "--fast"; }));
+
+	return appMain->Run();
 }
 
 namespace Star
 {
+	auto Main::Run() -> int
+	{
+		std::optional<EventRecorder> recorder{};
+		if (!m_RecordPath.empty() && m_ReplayPath.empty() && !Headless())
+			recorder.emplace(m_RecordPath);
+
+		if (!m_ReplayPath.empty())
+			RunReplay();
+		else if (Threaded() && !Headless())
+			RunThreaded(recorder ? &*recorder : nullptr);
+		else if (recorder)
+			RunRecorded(*recorder);
+		else
+			Simulate([this] {
+				RunPlatformJobs();
+				return Headless() || ProcessEvents();
+			});
+
+		return ExitCode();
+	}
+
+	auto Main::Simulate(const std::function<bool()>& processEvents) -> void
+	{
+		auto frameEnd = Clock::now();
+		auto frameStart = Clock::time_point{};
+		auto reportTime = frameEnd;
+		std::uint64_t ticks{};
+
+		while (!ExitRequested())
+		{
+			// Measured before processing events, so recorders can log the delta of the update they precede.
+			auto start = Clock::now();
+			auto elapsed = frameStart != Clock::time_point{} ? start - frameStart : Clock::duration{};
+			m_FrameDelta = std::chrono::duration<double>{elapsed}.count();
+			frameStart = start;
+
+			if (!processEvents())
+				RequestExit(EXIT_SUCCESS);
+
+			Update();
+			++ticks;
+
+			if (auto now = Clock::now(); now - reportTime >= TickReportInterval)
+			{
+				m_TicksPerSecond = static_cast<double>(ticks) / std::chrono::duration<double>{now - reportTime}.count();
+				reportTime = now;
+				ticks = 0;
+
+				if (Headless())
+					NOOP; // TODO: Log[Info] {m_TicksPerSecond} ticks per second
+			}
+
+			if (auto frameRate = TargetFrameRate(); frameRate > 0)
+			{
+				// Deadlines advance by whole frames to avoid drift, but restart after falling behind to avoid bursts.
+				frameEnd += std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>{1.0 / frameRate});
+				if (auto now = Clock::now(); frameEnd < now)
+					frameEnd = now;
+
+				WaitUntil(frameEnd);
+			}
+			else
+			{
+				frameEnd = Clock::now();
+			}
+		}
+	}
+
+	auto Main::RunThreaded(EventRecorder* recorder) -> void
+	{
+		EventQueue events{};
+		std::atomic<bool> quitRequested{};
+		std::atomic<bool> stopped{};
+
+		Window::EventSink(&events);
+
+		std::thread simulation{[&] {
+			Simulate([&] {
+				if (recorder != nullptr)
+					recorder->BeginFrame(SDL_GetTicks(), FrameDelta());
+
+				DispatchQueued(events, recorder);
+				Window::FlushEvents();
+
+				// Consumed like the quit of a single pump, so a vetoed exit is not requested again every update.
+				return !quitRequested.exchange(false, std::memory_order_acq_rel);
+			});
+
+			events.Close();
+			stopped.store(true, std::memory_order_release);
+		}};
+
+		while (!stopped.load(std::memory_order_acquire))
+		{
+			RunPlatformJobs();
+
+			SDL_Event event{};
+			if (SDL_WaitEventTimeout(&event, EventWaitTimeout) == 0)
+				continue;
+
+			do
+			{
+				if (!HandleEvent(event))
+					quitRequested.store(true, std::memory_order_release);
+			} while (SDL_PollEvent(&event) == 1);
+		}
+
+		simulation.join();
+		Window::EventSink(nullptr);
+	}
+
+	auto Main::RunRecorded(EventRecorder& recorder) -> void
+	{
+		EventQueue events{};
+		Window::EventSink(&events);
+
+		Simulate([&] {
+			RunPlatformJobs();
+			recorder.BeginFrame(SDL_GetTicks(), FrameDelta());
+
+			// Queued events are dispatched after every polled event, so the queue never fills up on this thread.
+			bool quitRequested{};
+			SDL_Event event{};
+			while (SDL_PollEvent(&event) == 1)
+			{
+				if (!HandleEvent(event))
+					quitRequested = true;
+
+				DispatchQueued(events, &recorder);
+			}
+
+			Window::FlushEvents();
+			return !quitRequested;
+		});
+
+		Window::EventSink(nullptr);
+	}
+
+	auto Main::RunReplay() -> void
+	{
+		EventReplay replay{m_ReplayPath};
+
+		// Paced replays wait for the recorded frame times instead, which already include the recorded pacing.
+		TargetFrameRate(0);
+
+		auto start = Clock::now();
+		Simulate([&] {
+			RunPlatformJobs();
+
+			if (m_ReplayPaced)
+				WaitUntil(start + std::chrono::milliseconds{replay.NextFrameTime()});
+
+			auto replayed = replay.Step();
+			m_FrameDelta = replayed ? replay.FrameDelta() : 0.0;
+			Window::FlushEvents();
+			return replayed;
+		});
+	}
+
 	auto Main::ExitRequested() const -> bool
 	{
 		return m_ExitCode.has_value();
@@ -63,6 +330,68 @@ namespace Star
 		return m_ExitCode.value_or(0);
 	}
 
+	auto Main::TargetFrameRate() const -> double
+	{
+		return m_TargetFrameRate;
+	}
+
+	auto Main::TargetFrameRate(double frameRate) -> void
+	{
+		m_TargetFrameRate = frameRate;
+	}
+
+	auto Main::Headless() const -> bool
+	{
+		return m_Headless;
+	}
+
+	auto Main::Headless(bool headless) -> void
+	{
+		m_Headless = headless;
+	}
+
+	auto Main::Threaded() const -> bool
+	{
+		return m_Threaded;
+	}
+
+	auto Main::Threaded(bool threaded) -> void
+	{
+		m_Threaded = threaded;
+	}
+
+	auto Main::Record(std::filesystem::path path) -> void
+	{
+		m_RecordPath = std::move(path);
+	}
+
+	auto Main::Replay(std::filesystem::path path, bool paced) -> void
+	{
+		m_ReplayPath = std::move(path);
+		m_ReplayPaced = paced;
+	}
+
+	auto Main::SchedulePlatform(std::function<void()> function) -> void
+	{
+		std::scoped_lock lock{m_PlatformMutex};
+		m_PlatformJobs.push_back(std::move(function));
+	}
+
+	auto Main::FrameDelta() const -> double
+	{
+		return m_FrameDelta;
+	}
+
+	auto Main::TicksPerSecond() const -> double
+	{
+		return m_TicksPerSecond;
+	}
+
+	auto Main::HeadlessRequested(std::span<const char*> args) -> bool
+	{
+		return std::ranges::any_of(args, [](std::string_view arg) { return arg == "--headless"; });
+	}
+
 	auto Main::ProcessEvents() -> bool
 	{
 		bool quitRequested{};
@@ -70,41 +399,24 @@ namespace Star
 		SDL_Event event{};
 		while (SDL_PollEvent(&event) == 1)
 		{
-			switch (event.type)
-			{
-			case SDL_QUIT:
+			if (!HandleEvent(event))
 				quitRequested = true;
-				break;
-
-			case SDL_WINDOWEVENT:
-				Window::HandleEvent(event.window);
-				break;
-
-			case SDL_KEYUP:
-			case SDL_KEYDOWN:
-				Window::HandleEvent(event.key);
-				break;
-
-			case SDL_MOUSEBUTTONUP:
-			case SDL_MOUSEBUTTONDOWN:
-				Window::HandleEvent(event.button);
-				break;
-
-			case SDL_MOUSEMOTION:
-				Window::HandleEvent(event.motion);
-				break;
+		}
 
-			case SDL_MOUSEWHEEL:
-				Window::HandleEvent(event.wheel);
-				break;
+		Window::FlushEvents();
+		return !quitRequested;
+	}
 
-			case SDL_TEXTINPUT:
-				Window::HandleEvent(event.text);
-				break;
-			}
+	auto Main::RunPlatformJobs() -> void
+	{
+		std::vector<std::function<void()>> jobs{};
+		{
+			std::scoped_lock lock{m_PlatformMutex};
+			jobs.swap(m_PlatformJobs);
 		}
 
-		return !quitRequested;
+		for (auto& job : jobs)
+			job();
 	}
 
 	auto Main::OnExitRequested() -> bool
@@ -1,11 +1,17 @@
 #pragma once
 
+#include <filesystem>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <span>
+#include <vector>
 
 namespace Star
 {
+	class EventRecorder;
+
 	/// @brief Application main loop.
 	class Main
 	{
@@ -16,6 +22,10 @@ namespace Star
 		/// @brief Advance the application state.
 		virtual auto Update() -> void = 0;
 
+		/// @brief Run the main loop until an exit is requested.
+		/// @return Exit code to return to the operating system.
+		auto Run() -> int;
+
 		/// @brief Check if an exit has been requested.
 		/// @return Status of the exit request.
 		[[nodiscard]] auto ExitRequested() const -> bool;
@@ -28,7 +38,73 @@ namespace Star
 		/// @return Value containing the exit code.
 		[[nodiscard]] auto ExitCode() const -> int;
 
+		/// @brief Get the number of frames per second the main loop is paced to.
+		/// @return Target frame rate, @c 0 if the main loop is not paced.
+		[[nodiscard]] auto TargetFrameRate() const -> double;
+
+		/// @brief Pace the main loop to a number of frames per second.
+		/// @details The main loop sleeps for the remainder of each frame and spins for the last moments to hit the
+		/// frame time precisely.
+		/// @param frameRate Target frame rate, @c 0 to update as fast as possible.
+		auto TargetFrameRate(double frameRate) -> void;
+
+		/// @brief Check if the main loop runs headless.
+		/// @return @c true if platform events are not processed, @c false otherwise.
+		[[nodiscard]] auto Headless() const -> bool;
+
+		/// @brief Run the main loop headless, without processing platform events.
+		/// @details Video is initialised after the application entry point returns, unless headless mode was
+		/// requested by then. Windows created from the entry point initialise video on their own.
+		/// @param headless @c true to skip processing platform events, @c false otherwise.
+		auto Headless(bool headless) -> void;
+
+		/// @brief Check if the application is updated on a separate thread.
+		/// @return @c true if platform events are pumped on a separate thread, @c false otherwise.
+		[[nodiscard]] auto Threaded() const -> bool;
+
+		/// @brief Update the application on a separate simulation thread.
+		/// @details The calling thread keeps pumping platform events into a bounded queue, which the simulation
+		/// drains once per update before dispatching the events to the window listeners. Input is picked up with
+		/// at most one update of delay, and the simulation keeps running while the platform blocks event pumping,
+		/// like while dragging a window. Windows must not be created or destroyed while the main loop runs, and other
+		/// platform calls are made through @c SchedulePlatform.
+		/// @param threaded @c true to use a separate simulation thread, @c false otherwise.
+		auto Threaded(bool threaded) -> void;
+
+		/// @brief Record the translated platform events of every frame to a log file.
+		/// @param path Path of the log file, empty to not record.
+		auto Record(std::filesystem::path path) -> void;
+
+		/// @brief Replay the platform events of a log file instead of processing them.
+		/// @details One recorded frame is dispatched per update and the main loop exits after the last one. Updates
+		/// receive the recorded frame delta and are not paced to the target frame rate. Windows receive the events
+		/// recorded for the window created in the same order.
+		/// @param path Path of the log file, empty to process platform events.
+		/// @param paced @c true to wait for the recorded time of every frame, @c false to replay as fast as possible.
+		auto Replay(std::filesystem::path path, bool paced) -> void;
+
+		/// @brief Schedule a function to be executed on the platform thread.
+		/// @details Intended for platform calls that are only allowed on the thread that initialised the platform,
+		/// which does not update the application when running threaded. Functions are executed once per event pump.
+		/// @param function Function to execute.
+		auto SchedulePlatform(std::function<void()> function) -> void;
+
+		/// @brief Get the time passed since the previous update.
+		/// @details Replays use the time recorded for every frame instead, so they update deterministically.
+		/// @return Seconds since the previous update started, @c 0 for the first update.
+		[[nodiscard]] auto FrameDelta() const -> double;
+
+		/// @brief Get the rate at which the main loop updates the application.
+		/// @return Updates per second measured over the last second.
+		[[nodiscard]] auto TicksPerSecond() const -> double;
+
+		/// @brief Check if headless mode is requested on the command line.
+		/// @param args Command line arguments.
+		/// @return @c true if the arguments contain @c --headless, @c false otherwise.
+		[[nodiscard]] static auto HeadlessRequested(std::span<const char*> args) -> bool;
+
 		/// @brief Process all pending platform events.
+		/// @details Batched window events are delivered afterwards.
 		/// @return Value indicating if the program should continue updating.
 		static auto ProcessEvents() -> bool;
 
@@ -38,7 +114,28 @@ namespace Star
 		virtual auto OnExitRequested() -> bool;
 
 	private:
+		auto Simulate(const std::function<bool()>& processEvents) -> void;
+
+		auto RunThreaded(EventRecorder* recorder) -> void;
+
+		auto RunRecorded(EventRecorder& recorder) -> void;
+
+		auto RunReplay() -> void;
+
+		auto RunPlatformJobs() -> void;
+
 		std::optional<int> m_ExitCode{};
+		double m_TargetFrameRate{};
+		double m_TicksPerSecond{};
+		double m_FrameDelta{};
+		bool m_Headless{};
+		bool m_Threaded{};
+		std::filesystem::path m_RecordPath{};
+		std::filesystem::path m_ReplayPath{};
+		bool m_ReplayPaced{};
+
+		std::mutex m_PlatformMutex{};
+		std::vector<std::function<void()>> m_PlatformJobs{};
 	};
 
 	/// @brief Application entry point.
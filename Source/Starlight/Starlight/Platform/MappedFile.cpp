@@ -0,0 +1,120 @@
+#include "MappedFile.hpp"
+
+#include <string>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+	[[nodiscard]] auto Error(const std::filesystem::path& path, const char* operation) -> Star::FileException
+	{
+		return Star::FileException{std::string{operation} + " failed for " + path.string()};
+	}
+} //namespace
+
+namespace Star
+{
+#if defined(_WIN32)
+	MappedFile::MappedFile(const std::filesystem::path& path)
+	{
+		auto* file = CreateFileW(
+			path.c_str(),
+			GENERIC_READ,
+			FILE_SHARE_READ,
+			nullptr,
+			OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+			nullptr
+		);
+
+		if (file == INVALID_HANDLE_VALUE)
+			throw Error(path, "Opening");
+
+		LARGE_INTEGER size{};
+		if (GetFileSizeEx(file, &size) == 0)
+		{
+			CloseHandle(file);
+			throw Error(path, "Querying the size");
+		}
+
+		m_Size = static_cast<std::size_t>(size.QuadPart);
+		if (m_Size == 0)
+		{
+			CloseHandle(file);
+			return;
+		}
+
+		m_Mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(file);
+
+		if (m_Mapping == nullptr)
+			throw Error(path, "Mapping");
+
+		m_Data = static_cast<const std::byte*>(MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0));
+		if (m_Data == nullptr)
+		{
+			CloseHandle(m_Mapping);
+			throw Error(path, "Mapping");
+		}
+	}
+
+	MappedFile::~MappedFile()
+	{
+		if (m_Data != nullptr)
+			UnmapViewOfFile(m_Data);
+
+		if (m_Mapping != nullptr)
+			CloseHandle(m_Mapping);
+	}
+#else
+	MappedFile::MappedFile(const std::filesystem::path& path)
+	{
+		auto file = open(path.c_str(), O_RDONLY | O_CLOEXEC); // NOLINT(*-vararg)
+		if (file < 0)
+			throw Error(path, "Opening");
+
+		struct stat status{};
+		if (fstat(file, &status) != 0)
+		{
+			close(file);
+			throw Error(path, "Querying the size");
+		}
+
+		m_Size = static_cast<std::size_t>(status.st_size);
+		if (m_Size == 0)
+		{
+			close(file);
+			return;
+		}
+
+		auto* data = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, file, 0);
+		close(file);
+
+		if (data == MAP_FAILED) // NOLINT(*-cstyle-cast, performance-no-int-to-ptr)
+			throw Error(path, "Mapping");
+
+		madvise(data, m_Size, MADV_SEQUENTIAL);
+		m_Data = static_cast<const std::byte*>(data);
+	}
+
+	MappedFile::~MappedFile()
+	{
+		if (m_Data != nullptr)
+			munmap(const_cast<std::byte*>(m_Data), m_Size); // NOLINT(*-const-cast)
+	}
+#endif
+
+	auto MappedFile::Data() const -> std::span<const std::byte>
+	{
+		return {m_Data, m_Size};
+	}
+} //namespace Star
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+
+namespace Star
+{
+	/// @brief Exception raised when a file specific error happens.
+	struct FileException : std::runtime_error
+	{
+		using runtime_error::runtime_error;
+	};
+
+	/// @brief Read-only file mapped into memory.
+	/// @details Pages are loaded on first access, so only the parts of the file that are read are paged in. The
+	/// mapping is advised for sequential access.
+	class MappedFile
+	{
+	public:
+		/// @brief Map a file into memory.
+		/// @param path Path of the file.
+		/// @throws FileException If the file cannot be opened or mapped.
+		explicit MappedFile(const std::filesystem::path& path);
+
+		/// @brief Destructor.
+		~MappedFile();
+
+		/// @brief Copy constructor.
+		/// @param other File to copy from.
+		MappedFile(const MappedFile& other) = delete;
+
+		/// @brief Move constructor.
+		/// @param other File to move from.
+		MappedFile(MappedFile&& other) = delete;
+
+		/// @brief Copy operator.
+		/// @param other File to copy from.
+		/// @return Reference to the current file.
+		auto operator=(const MappedFile& other) -> MappedFile& = delete;
+
+		/// @brief Move operator.
+		/// @param other File to move from.
+		/// @return Reference to the current file.
+		auto operator=(MappedFile&& other) -> MappedFile& = delete;
+
+		/// @brief Get the contents of the file.
+		/// @return Mapped bytes, aligned to the page size.
+		[[nodiscard]] auto Data() const -> std::span<const std::byte>;
+
+	private:
+		const std::byte* m_Data{};
+		std::size_t m_Size{};
+
+#if defined(_WIN32)
+		void* m_Mapping{};
+#endif
+	};
+} //namespace Star
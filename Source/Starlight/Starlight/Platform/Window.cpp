@@ -1,11 +1,19 @@
 #include "Window.hpp"
 
+#include "Starlight/Platform/EventQueue.hpp"
+
 #include <SDL2/SDL_events.h>
 #include <SDL2/SDL_mouse.h>
 #include <SDL2/SDL_video.h>
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
 #include <utility>
+#include <variant>
+#include <vector>
 
 namespace
 {
@@ -22,14 +30,26 @@ namespace
 		throw WindowException{SDL_GetError()};
 	}
 
-	constexpr auto WindowDataKey = "1fbb532a-1b2a-11ed-861d-0242ac120002";
+	/// Windows indexed by their SDL window ID. IDs are small and handed out in increasing order, so the table
+	/// stays dense and lookups are a single bounds check.
+	std::vector<Window*> g_WindowRegistry{};
 
-	[[nodiscard]] auto GetCurrentWindow(uint32_t windowId) -> Window*
+	auto RegisterWindow(std::uint32_t id, Window* window) -> void
 	{
-		if (auto* window = SDL_GetWindowFromID(windowId))
-			return static_cast<Window*>(SDL_GetWindowData(window, WindowDataKey));
+		if (id >= g_WindowRegistry.size())
+			g_WindowRegistry.resize(id + 1);
 
-		throw WindowException{SDL_GetError()};
+		g_WindowRegistry[id] = window;
+	}
+
+	EventQueue* g_EventSink{};
+
+	std::vector<Window*> g_BatchedWindows{};
+
+	auto ReplaceBatched(const Window* window, Window* replacement) -> void
+	{
+		if (auto entry = std::ranges::find(g_BatchedWindows, window); entry != g_BatchedWindows.end())
+			*entry = replacement;
 	}
 } //namespace
 
@@ -41,42 +61,96 @@ namespace Star
 	}
 
 	Window::Window(const char* title, glm::ivec2 size, uint32_t flags) :
-		m_Window{MakeWindow(title, size, flags)}
+		m_Window{MakeWindow(title, size, flags)},
+		m_Id{SDL_GetWindowID(Handle())}
 	{
-		SDL_SetWindowData(Handle(), WindowDataKey, this);
+		RegisterWindow(m_Id, this);
+	}
+
+	Window::~Window()
+	{
+		if (m_Window)
+			RegisterWindow(m_Id, nullptr);
+
+		std::erase(g_BatchedWindows, this);
 	}
 
 	Window::Window(Window&& other) noexcept :
 		m_Window{std::move(other.m_Window)},
+		m_Id{std::exchange(other.m_Id, 0)},
 		m_WindowListener{std::exchange(other.m_WindowListener, nullptr)},
 		m_InputListener{std::exchange(other.m_InputListener, nullptr)},
-		m_TextListener{std::exchange(other.m_TextListener, nullptr)}
+		m_TextListener{std::exchange(other.m_TextListener, nullptr)},
+		m_BatchListener{std::exchange(other.m_BatchListener, nullptr)},
+		m_Batch{std::move(other.m_Batch)}
 	{
-		SDL_SetWindowData(Handle(), WindowDataKey, this);
+		if (m_Window)
+			RegisterWindow(m_Id, this);
+
+		ReplaceBatched(&other, this);
 	}
 
 	auto Window::operator=(Window&& other) noexcept -> Window&
 	{
 		if (std::addressof(other) != this)
 		{
+			if (m_Window)
+				RegisterWindow(m_Id, nullptr);
+
 			m_Window = std::move(other.m_Window);
+			m_Id = std::exchange(other.m_Id, 0);
 			m_WindowListener = std::exchange(other.m_WindowListener, nullptr);
 			m_InputListener = std::exchange(other.m_InputListener, nullptr);
 			m_TextListener = std::exchange(other.m_TextListener, nullptr);
-			SDL_SetWindowData(Handle(), WindowDataKey, this);
+			m_BatchListener = std::exchange(other.m_BatchListener, nullptr);
+			m_Batch = std::move(other.m_Batch);
+
+			if (m_Window)
+				RegisterWindow(m_Id, this);
+
+			std::erase(g_BatchedWindows, this);
+			ReplaceBatched(&other, this);
 		}
 
 		return *this;
 	}
 
+	template <typename TArgs>
+	auto Window::Deliver(Window* self, std::uint32_t timestamp, const TArgs& args) -> void
+	{
+		if (g_EventSink == nullptr)
+		{
+			self->Receive(args);
+			return;
+		}
+
+		g_EventSink->Push(WindowEvent{
+			.WindowId = self->m_Id,
+			.Timestamp = timestamp,
+			.Args = args,
+		});
+	}
+
+	template <typename TArgs>
+	auto Window::Receive(const TArgs& args) -> void
+	{
+		if (m_BatchListener != nullptr)
+			m_Batch.Append(args);
+		else
+			OnEvent(args);
+	}
+
 	auto Window::HandleEvent(const SDL_WindowEvent& event) -> void
 	{
-		auto* self = GetCurrentWindow(event.windowID);
+		// Events may still arrive for windows destroyed since they were raised.
+		auto* self = Find(event.windowID);
+		if (self == nullptr)
+			return;
 
 		switch (event.event)
 		{
 		case SDL_WINDOWEVENT_CLOSE:
-			self->OnEvent(WindowCloseEventArgs{});
+			Deliver(self, event.timestamp, WindowCloseEventArgs{});
 			break;
 
 		case SDL_WINDOWEVENT_SIZE_CHANGED:
@@ -87,29 +161,29 @@ namespace Star
 			SDL_GetWindowSize(window, &args.Size.x, &args.Size.y);
 			SDL_GetWindowSizeInPixels(window, &args.Pixel.x, &args.Pixel.y);
 
-			self->OnEvent(args);
+			Deliver(self, event.timestamp, args);
 			break;
 		}
 		case SDL_WINDOWEVENT_ENTER:
-			self->OnEvent(MouseFocusChancedEventArgs{
+			Deliver(self, event.timestamp, MouseFocusChancedEventArgs{
 				.Focused = true,
 			});
 			break;
 
 		case SDL_WINDOWEVENT_LEAVE:
-			self->OnEvent(MouseFocusChancedEventArgs{
+			Deliver(self, event.timestamp, MouseFocusChancedEventArgs{
 				.Focused = false,
 			});
 			break;
 
 		case SDL_WINDOWEVENT_FOCUS_GAINED:
-			self->OnEvent(KeyboardFocusChancedEventArgs{
+			Deliver(self, event.timestamp, KeyboardFocusChancedEventArgs{
 				.Focused = true,
 			});
 			break;
 
 		case SDL_WINDOWEVENT_FOCUS_LOST:
-			self->OnEvent(KeyboardFocusChancedEventArgs{
+			Deliver(self, event.timestamp, KeyboardFocusChancedEventArgs{
 				.Focused = false,
 			});
 			break;
@@ -118,7 +192,9 @@ namespace Star
 
 	auto Window::HandleEvent(const SDL_KeyboardEvent& event) -> void
 	{
-		auto* self = GetCurrentWindow(event.windowID);
+		auto* self = Find(event.windowID);
+		if (self == nullptr)
+			return;
 
 		static_assert(static_cast<SDL_Scancode>(Key::Unknown) == SDL_SCANCODE_UNKNOWN);
 		static_assert(static_cast<SDL_Scancode>(Key::A) == SDL_SCANCODE_A);
@@ -336,7 +412,7 @@ namespace Star
 		static_assert(static_cast<SDL_Scancode>(Key::RightGui) == SDL_SCANCODE_RGUI);
 		static_assert(static_cast<SDL_Scancode>(Key::Count) == SDL_NUM_SCANCODES);
 
-		self->OnEvent(KeyboardEventArgs{
+		Deliver(self, event.timestamp, KeyboardEventArgs{
 			.Key = static_cast<Key>(event.keysym.scancode),
 			.Pressed = event.state == SDL_PRESSED,
 		});
@@ -344,7 +420,9 @@ namespace Star
 
 	auto Window::HandleEvent(const SDL_MouseButtonEvent& event) -> void
 	{
-		auto* self = GetCurrentWindow(event.windowID);
+		auto* self = Find(event.windowID);
+		if (self == nullptr)
+			return;
 
 		static constexpr std::array sdlButtonMappings{
 			Button{-1},
@@ -361,7 +439,7 @@ namespace Star
 		static_assert(sdlButtonMappings[SDL_BUTTON_X1] == Button::M4);
 		static_assert(sdlButtonMappings[SDL_BUTTON_X2] == Button::M5);
 
-		self->OnEvent(MouseButtonEventArgs{
+		Deliver(self, event.timestamp, MouseButtonEventArgs{
 			.Button = sdlButtonMappings.at(event.button),
 			.Pressed = event.state == SDL_PRESSED,
 			.Position = glm::i32vec2({
@@ -373,9 +451,11 @@ namespace Star
 
 	auto Window::HandleEvent(const SDL_MouseMotionEvent& event) -> void
 	{
-		auto* self = GetCurrentWindow(event.windowID);
+		auto* self = Find(event.windowID);
+		if (self == nullptr)
+			return;
 
-		self->OnEvent(MouseMotionEventArgs{
+		Deliver(self, event.timestamp, MouseMotionEventArgs{
 			.Position = glm::i32vec2({
 				event.x,
 				event.y,
@@ -389,9 +469,11 @@ namespace Star
 
 	auto Window::HandleEvent(const SDL_MouseWheelEvent& event) -> void
 	{
-		auto* self = GetCurrentWindow(event.windowID);
+		auto* self = Find(event.windowID);
+		if (self == nullptr)
+			return;
 
-		self->OnEvent(MouseScrollEventArgs{
+		Deliver(self, event.timestamp, MouseScrollEventArgs{
 			.Scroll = glm::vec2({
 				event.preciseX,
 				event.preciseY,
@@ -401,11 +483,54 @@ namespace Star
 
 	auto Window::HandleEvent(const SDL_TextInputEvent& event) -> void
 	{
-		auto* self = GetCurrentWindow(event.windowID);
+		auto* self = Find(event.windowID);
+		if (self == nullptr)
+			return;
 
-		self->OnEvent(TextInputEventArgs{
-			.Text = static_cast<const char*>(event.text),
-		});
+		if (g_EventSink == nullptr)
+		{
+			self->Receive(TextInputEventArgs{
+				.Text = static_cast<const char*>(event.text),
+			});
+			return;
+		}
+
+		WindowEvent queued{
+			.WindowId = self->m_Id,
+			.Timestamp = event.timestamp,
+			.Args = TextInputEventArgs{},
+		};
+
+		std::string_view text{static_cast<const char*>(event.text)};
+		std::ranges::copy(text.substr(0, queued.Text.size() - 1), queued.Text.begin());
+		g_EventSink->Push(queued);
+	}
+
+	auto Window::EventSink(EventQueue* queue) -> void
+	{
+		g_EventSink = queue;
+	}
+
+	auto Window::Dispatch(const WindowEvent& event) -> void
+	{
+		auto* self = Find(event.WindowId);
+		if (self == nullptr)
+			return;
+
+		std::visit(
+			[&]<typename TArgs>(const TArgs& args) {
+				if constexpr (std::is_same_v<TArgs, TextInputEventArgs>)
+					self->Receive(TextInputEventArgs{.Text = event.Text.data()});
+				else
+					self->Receive(args);
+			},
+			event.Args
+		);
+	}
+
+	auto Window::Find(std::uint32_t id) -> Window*
+	{
+		return id < g_WindowRegistry.size() ? g_WindowRegistry[id] : nullptr;
 	}
 
 	auto Window::Handle() const -> SDL_Window*
@@ -413,6 +538,11 @@ namespace Star
 		return m_Window.get();
 	}
 
+	auto Window::Id() const -> std::uint32_t
+	{
+		return m_Id;
+	}
+
 	auto Window::WindowListener() const -> IWindowListener*
 	{
 		return m_WindowListener;
@@ -443,6 +573,39 @@ namespace Star
 		m_TextListener = listener;
 	}
 
+	auto Window::BatchListener() const -> IEventBatchListener*
+	{
+		return m_BatchListener;
+	}
+
+	auto Window::BatchListener(IEventBatchListener* listener) -> void
+	{
+		if ((m_BatchListener == nullptr) != (listener == nullptr))
+		{
+			if (listener != nullptr)
+				g_BatchedWindows.push_back(this);
+			else
+				std::erase(g_BatchedWindows, this);
+		}
+
+		m_BatchListener = listener;
+		m_Batch.Clear();
+	}
+
+	auto Window::FlushEvents() -> void
+	{
+		// Listeners may change the batched windows, so entries are revisited by index.
+		for (std::size_t i = 0; i < g_BatchedWindows.size(); ++i)
+		{
+			auto* window = g_BatchedWindows[i];
+			if (window->m_Batch.Empty())
+				continue;
+
+			window->m_BatchListener->OnEvents(window, window->m_Batch);
+			window->m_Batch.Clear();
+		}
+	}
+
 	auto Window::OnEvent(const WindowCloseEventArgs& event) -> void
 	{
 		if (m_WindowListener != nullptr)
@@ -496,4 +659,100 @@ namespace Star
 		if (m_TextListener != nullptr)
 			m_TextListener->OnEvent(this, event);
 	}
+
+	auto WindowEventBatch::Empty() const -> bool
+	{
+		return m_TextRanges.empty() &&
+			std::apply([](const auto&... events) { return (events.empty() && ...); }, m_Events);
+	}
+
+	auto WindowEventBatch::Append(const WindowCloseEventArgs& event) -> void
+	{
+		Push(event);
+	}
+
+	auto WindowEventBatch::Append(const WindowResizeEventArgs& event) -> void
+	{
+		if (auto& resizes = std::get<std::vector<WindowResizeEventArgs>>(m_Events); !resizes.empty())
+		{
+			resizes.back() = event;
+			m_Coalescing = false;
+		}
+		else
+			Push(event);
+	}
+
+	auto WindowEventBatch::Append(const MouseFocusChancedEventArgs& event) -> void
+	{
+		Push(event);
+	}
+
+	auto WindowEventBatch::Append(const KeyboardFocusChancedEventArgs& event) -> void
+	{
+		Push(event);
+	}
+
+	auto WindowEventBatch::Append(const KeyboardEventArgs& event) -> void
+	{
+		Push(event);
+	}
+
+	auto WindowEventBatch::Append(const MouseButtonEventArgs& event) -> void
+	{
+		Push(event);
+	}
+
+	auto WindowEventBatch::Append(const MouseMotionEventArgs& event) -> void
+	{
+		// Only movements without any other event in between are coalesced, so button positions stay meaningful.
+		auto& motions = std::get<std::vector<MouseMotionEventArgs>>(m_Events);
+		if (m_Coalescing)
+		{
+			motions.back().Position = event.Position;
+			motions.back().Movement += event.Movement;
+			return;
+		}
+
+		Push(event);
+		m_Coalescing = true;
+	}
+
+	auto WindowEventBatch::Append(const MouseScrollEventArgs& event) -> void
+	{
+		Push(event);
+	}
+
+	auto WindowEventBatch::Append(const TextInputEventArgs& event) -> void
+	{
+		m_TextRanges.emplace_back(m_Text.size(), event.Text.size());
+		m_Text.append(event.Text);
+		m_Coalescing = false;
+	}
+
+	auto WindowEventBatch::Clear() -> void
+	{
+		std::apply([](auto&... events) { (events.clear(), ...); }, m_Events);
+		m_Text.clear();
+		m_TextRanges.clear();
+		m_TextViews.clear();
+		m_Coalescing = false;
+	}
+
+	auto WindowEventBatch::TextEvents() const -> std::span<const TextInputEventArgs>
+	{
+		// Only views of events appended since the last access are built, unless the text has moved since.
+		if (m_TextData != m_Text.data())
+		{
+			m_TextViews.clear();
+			m_TextData = m_Text.data();
+		}
+
+		for (auto index = m_TextViews.size(); index < m_TextRanges.size(); ++index)
+		{
+			auto [offset, length] = m_TextRanges[index];
+			m_TextViews.push_back({.Text = std::string_view{m_Text}.substr(offset, length)});
+		}
+
+		return m_TextViews;
+	}
 } //namespace Star
@@ -2,9 +2,16 @@
 
 #include <glm/vec2.hpp>
 
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <stdexcept>
+#include <string>
 #include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 struct SDL_Window;
 struct SDL_WindowEvent;
@@ -762,6 +769,8 @@ namespace Star
 	};
 
 	class Window;
+	class EventQueue;
+	struct WindowEvent;
 
 	/// @brief Window event listener.
 	class IWindowListener
@@ -832,6 +841,111 @@ namespace Star
 		virtual auto OnEvent(Window* sender, const TextInputEventArgs& event) -> void = 0;
 	};
 
+	/// @brief Events of a window accumulated over a frame, stored in a contiguous array per event type.
+	/// @details Consecutive mouse movements are coalesced into a single event with the latest position and the
+	/// summed movement, and only the latest resize of a frame is kept. The order between different event types is
+	/// not preserved.
+	class WindowEventBatch
+	{
+	public:
+		/// @brief Get the events of a type.
+		/// @tparam TArgs Event argument type.
+		/// @return Events in the order they were raised, valid until the batch is changed.
+		template <typename TArgs>
+		[[nodiscard]] auto Events() const -> std::span<const TArgs>
+		{
+			if constexpr (std::is_same_v<TArgs, TextInputEventArgs>)
+				return TextEvents();
+			else
+				return std::get<std::vector<TArgs>>(m_Events);
+		}
+
+		/// @brief Check if the batch contains no events.
+		/// @return @c true if empty, @c false otherwise.
+		[[nodiscard]] auto Empty() const -> bool;
+
+		/// @brief Append an event, coalescing it with the previous one if possible.
+		/// @param event Event arguments.
+		auto Append(const WindowCloseEventArgs& event) -> void;
+
+		/// @brief Append an event, coalescing it with the previous one if possible.
+		/// @param event Event arguments.
+		auto Append(const WindowResizeEventArgs& event) -> void;
+
+		/// @brief Append an event, coalescing it with the previous one if possible.
+		/// @param event Event arguments.
+		auto Append(const MouseFocusChancedEventArgs& event) -> void;
+
+		/// @brief Append an event, coalescing it with the previous one if possible.
+		/// @param event Event arguments.
+		auto Append(const KeyboardFocusChancedEventArgs& event) -> void;
+
+		/// @brief Append an event, coalescing it with the previous one if possible.
+		/// @param event Event arguments.
+		auto Append(const KeyboardEventArgs& event) -> void;
+
+		/// @brief Append an event, coalescing it with the previous one if possible.
+		/// @param event Event arguments.
+		auto Append(const MouseButtonEventArgs& event) -> void;
+
+		/// @brief Append an event, coalescing it with the previous one if possible.
+		/// @param event Event arguments.
+		auto Append(const MouseMotionEventArgs& event) -> void;
+
+		/// @brief Append an event, coalescing it with the previous one if possible.
+		/// @param event Event arguments.
+		auto Append(const MouseScrollEventArgs& event) -> void;
+
+		/// @brief Append an event, copying its text into the batch.
+		/// @param event Event arguments.
+		auto Append(const TextInputEventArgs& event) -> void;
+
+		/// @brief Remove all events, keeping the allocated memory for the next frame.
+		auto Clear() -> void;
+
+	private:
+		template <typename TArgs>
+		auto Push(const TArgs& event) -> void
+		{
+			std::get<std::vector<TArgs>>(m_Events).push_back(event);
+			m_Coalescing = false;
+		}
+
+		std::tuple<
+			std::vector<WindowCloseEventArgs>,
+			std::vector<WindowResizeEventArgs>,
+			std::vector<MouseFocusChancedEventArgs>,
+			std::vector<KeyboardFocusChancedEventArgs>,
+			std::vector<KeyboardEventArgs>,
+			std::vector<MouseButtonEventArgs>,
+			std::vector<MouseMotionEventArgs>,
+			std::vector<MouseScrollEventArgs>>
+			m_Events{};
+
+		[[nodiscard]] auto TextEvents() const -> std::span<const TextInputEventArgs>;
+
+		// Text events are stored as ranges of the text, since appending or moving the batch may move the text. Their
+		// views are built on access and rebuilt once the text has moved.
+		std::string m_Text{};
+		std::vector<std::pair<std::size_t, std::size_t>> m_TextRanges{};
+		mutable std::vector<TextInputEventArgs> m_TextViews{};
+		mutable const char* m_TextData{};
+		bool m_Coalescing{};
+	};
+
+	/// @brief Batched event listener.
+	class IEventBatchListener
+	{
+	public:
+		/// @brief Destructor.
+		virtual ~IEventBatchListener() = default;
+
+		/// @brief Event handler for all events of a frame.
+		/// @param sender Event sender.
+		/// @param events Events raised since the previous frame.
+		virtual auto OnEvents(Window* sender, const WindowEventBatch& events) -> void = 0;
+	};
+
 	/// @brief Deleter used for SDL specific resources.
 	struct SDLDeleter
 	{
@@ -861,7 +975,7 @@ namespace Star
 		explicit Window(const char* title, glm::ivec2 size, uint32_t flags);
 
 		/// @brief Destructor.
-		virtual ~Window() = default;
+		virtual ~Window();
 
 		/// @brief Copy constructor.
 		/// @param other Window to copy from.
@@ -905,10 +1019,30 @@ namespace Star
 		/// @param event Event to dispatch.
 		static auto HandleEvent(const SDL_TextInputEvent& event) -> void;
 
+		/// @brief Queue handled events instead of dispatching them immediately.
+		/// @details Lets platform events be pumped on a different thread than the one the listeners run on. Queued
+		/// events of windows destroyed in the meantime are dropped.
+		/// @param queue Queue receiving the translated events, @c nullptr to dispatch immediately.
+		static auto EventSink(EventQueue* queue) -> void;
+
+		/// @brief Dispatches a queued event to its window.
+		/// @param event Event to dispatch.
+		static auto Dispatch(const WindowEvent& event) -> void;
+
+		/// @brief Find the window with a specific ID.
+		/// @details Used to route events to their window without querying the platform.
+		/// @param id Window ID.
+		/// @return Window with the ID, @c nullptr if it does not exist (anymore).
+		[[nodiscard]] static auto Find(std::uint32_t id) -> Window*;
+
 		/// @brief Get the underlying handle of this window.
 		/// @return Underlying handle.
 		[[nodiscard]] auto Handle() const -> SDL_Window*;
 
+		/// @brief Get the ID of this window.
+		/// @return Window ID, @c 0 for windows that have been moved from.
+		[[nodiscard]] auto Id() const -> std::uint32_t;
+
 		/// @brief Get the window event listener of this window.
 		/// @return Current window event listener.
 		[[nodiscard]] auto WindowListener() const -> IWindowListener*;
@@ -933,6 +1067,19 @@ namespace Star
 		/// @param listener New text event listener.
 		auto TextListener(ITextListener* listener) -> void;
 
+		/// @brief Get the batched event listener of this window.
+		/// @return Current batched event listener.
+		[[nodiscard]] auto BatchListener() const -> IEventBatchListener*;
+
+		/// @brief Set the batched event listener for this window.
+		/// @details While set, events are accumulated into a batch delivered once per frame by @c FlushEvents,
+		/// instead of being dispatched one by one to the event handlers and other listeners.
+		/// @param listener New batched event listener, @c nullptr to dispatch events one by one.
+		auto BatchListener(IEventBatchListener* listener) -> void;
+
+		/// @brief Deliver the accumulated events of all windows with a batched event listener.
+		static auto FlushEvents() -> void;
+
 	protected:
 		/// @brief Event handler for window closing.
 		/// @param event Event arguments.
@@ -971,10 +1118,19 @@ namespace Star
 		virtual auto OnEvent(const TextInputEventArgs& event) -> void;
 
 	private:
+		template <typename TArgs>
+		static auto Deliver(Window* self, std::uint32_t timestamp, const TArgs& args) -> void;
+
+		template <typename TArgs>
+		auto Receive(const TArgs& args) -> void;
+
 		SDLPointer<SDL_Window> m_Window{};
+		std::uint32_t m_Id{};
 
 		IWindowListener* m_WindowListener{};
 		IInputListener* m_InputListener{};
 		ITextListener* m_TextListener{};
+		IEventBatchListener* m_BatchListener{};
+		WindowEventBatch m_Batch{};
 	};
 } //namespace Star
@@ -1,29 +1,121 @@
 #include "Application.hpp"
 
+#include "Starlight/Runtime/Input.hpp"
+#include "Starlight/Runtime/Profiler.hpp"
+
+#include <algorithm>
+#include <utility>
+
 namespace Star
 {
 	auto Application::Update() -> void
 	{
-		Systems().Update(Entities());
+		// Taken first, so allocations of the profiler are counted as well.
+		auto heap = CurrentHeapStats();
+
+#if defined(STARLIGHT_ENABLE_PROFILER)
+		Profiler::Collect();
+#endif
+
+		STAR_PROFILE_ZONE("Frame");
+
+		// Replays provide the recorded delta of every frame.
+		auto delta = FrameDelta();
+
+		// The application is updated off the thread that created it when running threaded.
+		m_Jobs.Bind();
+		m_Jobs.RunMainJobs();
+		// The main world is not part of the concurrent step, since its systems may rely on running on the owning
+		// thread, like waiting for main thread jobs. Its systems still spread over the job system.
+		m_World.Update(delta);
+
+		m_Jobs.ParallelFor(m_Worlds.size(), [&](std::size_t index) { m_Worlds[index]->Update(delta); });
+
+		m_Frames.Reset();
+
+		auto current = CurrentHeapStats();
+		m_FrameHeap = {
+			.Allocations = current.Allocations - heap.Allocations,
+			.Bytes = current.Bytes - heap.Bytes,
+		};
+	}
+
+	auto Application::OnEvents([[maybe_unused]] Window* sender, const WindowEventBatch& events) -> void
+	{
+		Entities().GetSingleton<InputState>().Apply(events);
+	}
+
+	auto Application::WorldSetup(std::function<void(World&)> setup) -> void
+	{
+		m_WorldSetup = std::move(setup);
+	}
+
+	auto Application::CreateWorld() -> World&
+	{
+		auto world = std::make_unique<World>(m_Jobs, &m_Frames);
+		if (m_WorldSetup)
+			m_WorldSetup(*world);
+
+		return *m_Worlds.emplace_back(std::move(world));
+	}
+
+	auto Application::DestroyWorld(const World& world) -> bool
+	{
+		return std::erase_if(m_Worlds, [&](const auto& entry) { return entry.get() == &world; }) > 0;
+	}
+
+	auto Application::Worlds() const -> std::span<const std::unique_ptr<World>>
+	{
+		return m_Worlds;
+	}
+
+	auto Application::Jobs() -> JobSystem&
+	{
+		return m_Jobs;
+	}
+
+	auto Application::Jobs() const -> const JobSystem&
+	{
+		return m_Jobs;
+	}
+
+	auto Application::Frames() -> FrameAllocator&
+	{
+		return m_Frames;
+	}
+
+	auto Application::FrameHeapStats() const -> const HeapStats&
+	{
+		return m_FrameHeap;
+	}
+
+	auto Application::MainWorld() -> World&
+	{
+		return m_World;
+	}
+
+	auto Application::MainWorld() const -> const World&
+	{
+		return m_World;
 	}
 
 	auto Application::Entities() -> EntityManager&
 	{
-		return m_Entities;
+		return m_World.Entities();
 	}
 
 	auto Application::Entities() const -> const EntityManager&
 	{
-		return m_Entities;
+		return m_World.Entities();
 	}
 
 	auto Application::Systems() -> SystemManager&
 	{
-		return m_Systems;
+		return m_World.Systems();
 	}
 
 	auto Application::Systems() const -> const SystemManager&
 	{
-		return m_Systems;
+		return m_World.Systems();
 	}
 } //namespace Star
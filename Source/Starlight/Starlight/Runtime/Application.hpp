@@ -1,35 +1,99 @@
 #pragma once
 
 #include "Starlight/Platform/Main.hpp"
+#include "Starlight/Platform/Window.hpp"
 #include "Starlight/Runtime/Entity.hpp"
+#include "Starlight/Runtime/Job.hpp"
+#include "Starlight/Runtime/Memory.hpp"
 #include "Starlight/Runtime/System.hpp"
+#include "Starlight/Runtime/World.hpp"
+
+#include <functional>
+#include <memory>
+#include <span>
+#include <vector>
 
 namespace Star
 {
 	/// @brief Application runtime.
-	class Application : public Main
+	/// @details Owns a main world updated on the thread calling @c Update, which also takes ownership of the job
+	/// system, and any number of additional worlds updated concurrently on the job system afterwards. All worlds
+	/// share a frame allocator that is reset at the end of every update. Input of windows batching their events to
+	/// the application is applied to the @c InputState singleton of the main world.
+	class Application : public Main, public IEventBatchListener
 	{
 	public:
 		auto Update() -> void override;
 
-		/// @brief Get the entity manager.
+		auto OnEvents(Window* sender, const WindowEventBatch& events) -> void override;
+
+		/// @brief Set the function creating the systems of worlds.
+		/// @details Only applies to worlds created afterwards.
+		/// @param setup Function invoked with every newly created world.
+		auto WorldSetup(std::function<void(World&)> setup) -> void;
+
+		/// @brief Create an additional world.
+		/// @return A reference to the world.
+		auto CreateWorld() -> World&;
+
+		/// @brief Destroy an additional world.
+		/// @param world World to destroy.
+		/// @return @c true if the world was destroyed, @c false otherwise.
+		auto DestroyWorld(const World& world) -> bool;
+
+		/// @brief Get the additional worlds.
+		/// @return Worlds in creation order.
+		[[nodiscard]] auto Worlds() const -> std::span<const std::unique_ptr<World>>;
+
+		/// @brief Get the job system.
+		/// @return A reference to the job system.
+		[[nodiscard]] auto Jobs() -> JobSystem&;
+
+		/// @brief Get the job system.
+		/// @return A reference to the job system.
+		[[nodiscard]] auto Jobs() const -> const JobSystem&;
+
+		/// @brief Get the frame allocator.
+		/// @return A reference to the frame allocator.
+		[[nodiscard]] auto Frames() -> FrameAllocator&;
+
+		/// @brief Get the global heap allocations made during the latest update.
+		/// @details Only counted when built with @c STARLIGHT_COUNT_ALLOCATIONS, otherwise always empty.
+		/// @return Allocation statistics.
+		[[nodiscard]] auto FrameHeapStats() const -> const HeapStats&;
+
+		/// @brief Get the main world.
+		/// @return A reference to the main world.
+		[[nodiscard]] auto MainWorld() -> World&;
+
+		/// @brief Get the main world.
+		/// @return A reference to the main world.
+		[[nodiscard]] auto MainWorld() const -> const World&;
+
+		/// @brief Get the entity manager of the main world.
 		/// @return A reference to the entity manager.
 		[[nodiscard]] auto Entities() -> EntityManager&;
 
-		/// @brief Get the entity manager.
+		/// @brief Get the entity manager of the main world.
 		/// @return A reference to the entity manager.
 		[[nodiscard]] auto Entities() const -> const EntityManager&;
 
-		/// @brief Get the system manager.
+		/// @brief Get the system manager of the main world.
 		/// @return A reference to the system manager.
 		[[nodiscard]] auto Systems() -> SystemManager&;
 
-		/// @brief Get the system manager.
+		/// @brief Get the system manager of the main world.
 		/// @return A reference to the system manager.
 		[[nodiscard]] auto Systems() const -> const SystemManager&;
 
 	private:
-		EntityManager m_Entities{};
-		SystemManager m_Systems{};
+		JobSystem m_Jobs{};
+		FrameAllocator m_Frames{&m_Jobs};
+		World m_World{m_Jobs, &m_Frames};
+
+		std::function<void(World&)> m_WorldSetup{};
+		std::vector<std::unique_ptr<World>> m_Worlds{};
+
+		HeapStats m_FrameHeap{};
 	};
 } //namespace Star
@@ -0,0 +1,180 @@
+#include "Command.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <tuple>
+
+namespace Star
+{
+	CommandBuffer::~CommandBuffer()
+	{
+		Clear();
+	}
+
+	auto CommandBuffer::Create() -> PendingEntity
+	{
+		return PendingEntity{m_Created++};
+	}
+
+	auto CommandBuffer::Destroy(CommandTarget entity) -> void
+	{
+		Record(Command{
+			.Kind = Command::Type::DestroyEntity,
+			.Target = entity,
+		});
+	}
+
+	auto CommandBuffer::Empty() const -> bool
+	{
+		return m_Commands.empty() && m_Created == 0;
+	}
+
+	auto CommandBuffer::Allocate(std::size_t size, std::size_t alignment) -> void*
+	{
+		for (; m_Block < m_Blocks.size(); ++m_Block, m_Offset = 0)
+		{
+			auto& block = m_Blocks[m_Block];
+
+			void* data = block.Data.get() + m_Offset;
+			auto space = block.Size - m_Offset;
+
+			if (std::align(alignment, size, data, space) != nullptr)
+			{
+				m_Offset = block.Size - space + size;
+				return data;
+			}
+		}
+
+		auto blockSize = std::max(BlockSize, size + alignment);
+		m_Blocks.push_back(Block{
+			.Data = std::make_unique<std::byte[]>(blockSize),
+			.Size = blockSize,
+		});
+
+		return Allocate(size, alignment);
+	}
+
+	auto CommandBuffer::Record(const Command& command) -> void
+	{
+		m_Commands.push_back(command);
+	}
+
+	auto CommandBuffer::Clear() -> void
+	{
+		for (auto& command : m_Commands)
+		{
+			if (command.Discard != nullptr && command.Payload != nullptr)
+				command.Discard(command.Payload);
+		}
+
+		m_Commands.clear();
+		m_Created = 0;
+		m_Block = 0;
+		m_Offset = 0;
+	}
+
+	CommandQueue::CommandQueue(const JobSystem* jobs) :
+		m_Jobs{jobs},
+		m_Buffers(jobs != nullptr ? jobs->ThreadCount() : 1)
+	{
+		for (auto& buffer : m_Buffers)
+			m_Local.push_back(&buffer);
+	}
+
+	auto CommandQueue::Local() -> CommandBuffer&
+	{
+		if (m_Jobs == nullptr)
+			return *m_Local.front();
+
+		if (m_Jobs->Participates())
+			return *m_Local[m_Jobs->ThreadIndex()];
+
+		std::scoped_lock lock{*m_ForeignMutex};
+
+		auto thread = std::this_thread::get_id();
+		auto foreign = std::ranges::find(m_Foreign, thread, &decltype(m_Foreign)::value_type::first);
+		if (foreign != m_Foreign.end())
+			return *foreign->second;
+
+		return *m_Foreign.emplace_back(thread, &m_Buffers.emplace_back()).second;
+	}
+
+	auto CommandQueue::Empty() const -> bool
+	{
+		return std::ranges::all_of(m_Buffers, &CommandBuffer::Empty);
+	}
+
+	auto CommandQueue::Playback(EntityManager& entities) -> void
+	{
+		using Command = CommandBuffer::Command;
+
+		struct Entry
+		{
+			Command* Instance{};
+			Entity Target{};
+		};
+
+		// Recorded payloads have to be destroyed even if applying a command throws.
+		struct Clear
+		{
+			std::deque<CommandBuffer>& Buffers;
+
+			~Clear()
+			{
+				for (auto& buffer : Buffers)
+					buffer.Clear();
+			}
+		} clear{m_Buffers};
+
+		std::vector<Entry> changes{};
+		std::vector<Entity> destroyed{};
+		std::vector<Entity> created{};
+
+		for (auto& buffer : m_Buffers)
+		{
+			created.resize(buffer.m_Created);
+			for (auto& entity : created)
+				entity = entities.Create();
+
+			for (auto& command : buffer.m_Commands)
+			{
+				auto target = command.Target.Pending != CommandTarget::NotPending ? created[command.Target.Pending]
+																				  : command.Target.Existing;
+
+				if (command.Kind == Command::Type::DestroyEntity)
+					destroyed.push_back(target);
+				else
+					changes.push_back(Entry{.Instance = &command, .Target = target});
+			}
+		}
+
+		std::ranges::sort(destroyed);
+		destroyed.erase(std::unique(destroyed.begin(), destroyed.end()), destroyed.end());
+
+		// Changes are batched per component storage, keeping the recording order between changes of the same
+		// component on the same entity so the latest one wins.
+		std::ranges::stable_sort(changes, {}, [](const Entry& entry) {
+			return std::tuple{entry.Instance->Component, entry.Target};
+		});
+
+		for (std::size_t i = 0; i < changes.size(); ++i)
+		{
+			auto& [command, target] = changes[i];
+
+			auto superseded = i + 1 < changes.size() && changes[i + 1].Instance->Component == command->Component &&
+							  changes[i + 1].Target == target;
+
+			if (superseded || std::ranges::binary_search(destroyed, target) || !entities.Valid(target))
+				continue;
+
+			command->Apply(entities, target, command->Payload);
+			command->Payload = nullptr;
+		}
+
+		for (auto entity : destroyed)
+		{
+			if (entities.Valid(entity))
+				entities.Destroy(entity);
+		}
+	}
+} //namespace Star
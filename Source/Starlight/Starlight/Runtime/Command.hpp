@@ -0,0 +1,250 @@
+#pragma once
+
+#include "Starlight/Runtime/Entity.hpp"
+#include "Starlight/Runtime/Job.hpp"
+
+#include <entt/core/type_info.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Star
+{
+	class CommandBuffer;
+
+	/// @brief Handle to an entity whose creation has been recorded in a command buffer.
+	/// @details Only valid for commands recorded in the same buffer before it is played back.
+	class PendingEntity
+	{
+	private:
+		friend class CommandBuffer;
+		friend struct CommandTarget;
+
+		explicit PendingEntity(std::uint32_t index) :
+			m_Index{index}
+		{
+		}
+
+		std::uint32_t m_Index{};
+	};
+
+	/// @brief Entity targeted by a recorded command.
+	struct CommandTarget
+	{
+		/// @brief Index used for targets that are not pending.
+		static constexpr auto NotPending = std::numeric_limits<std::uint32_t>::max();
+
+		/// @brief Target an existing entity.
+		/// @param entity Entity handle.
+		CommandTarget(Entity entity) : // NOLINT(google-explicit-constructor)
+			Existing{entity}
+		{
+		}
+
+		/// @brief Target an entity created by the same command buffer.
+		/// @param entity Pending entity handle.
+		CommandTarget(PendingEntity entity) : // NOLINT(google-explicit-constructor)
+			Pending{entity.m_Index}
+		{
+		}
+
+		/// @brief Existing entity handle.
+		Entity Existing{};
+
+		/// @brief Index of the pending entity in its command buffer.
+		std::uint32_t Pending{NotPending};
+	};
+
+	/// @brief Buffer recording structural entity changes to be played back later.
+	/// @details Component values are stored in a linear arena reused across playbacks. A buffer must only be recorded
+	/// into by a single thread at a time.
+	class alignas(CacheLineSize) CommandBuffer
+	{
+	public:
+		/// @brief Create an empty command buffer.
+		CommandBuffer() = default;
+
+		/// @brief Destructor, discarding commands that have not been played back.
+		~CommandBuffer();
+
+		/// @brief Copy constructor.
+		/// @param other Command buffer to copy from.
+		CommandBuffer(const CommandBuffer& other) = delete;
+
+		/// @brief Move constructor.
+		/// @param other Command buffer to move from.
+		CommandBuffer(CommandBuffer&& other) noexcept = default;
+
+		/// @brief Copy operator.
+		/// @param other Command buffer to copy from.
+		/// @return Reference to the current command buffer.
+		auto operator=(const CommandBuffer& other) -> CommandBuffer& = delete;
+
+		/// @brief Move operator.
+		/// @param other Command buffer to move from.
+		/// @return Reference to the current command buffer.
+		auto operator=(CommandBuffer&& other) -> CommandBuffer& = delete;
+
+		/// @brief Record the creation of an entity.
+		/// @return Handle to refer to the entity in further commands of this buffer.
+		[[nodiscard]] auto Create() -> PendingEntity;
+
+		/// @brief Record the destruction of an entity.
+		/// @details Component changes recorded for the same entity are dropped.
+		/// @param entity Entity handle.
+		auto Destroy(CommandTarget entity) -> void;
+
+		/// @brief Record the creation of a component, replacing the component if it exists.
+		/// @tparam TType Component type.
+		/// @tparam TArgs Component constructor argument types.
+		/// @param entity Entity handle.
+		/// @param args Component constructor arguments.
+		template <typename TType, typename... TArgs>
+		auto CreateComponent(CommandTarget entity, TArgs&&... args) -> void
+		{
+			auto* storage = Allocate(sizeof(TType), alignof(TType));
+
+			TType* component{};
+			if constexpr (std::is_aggregate_v<TType>)
+				component = new (storage) TType{std::forward<TArgs>(args)...};
+			else
+				component = new (storage) TType(std::forward<TArgs>(args)...);
+
+			Record(Command{
+				.Kind = Command::Type::Create,
+				.Target = entity,
+				.Component = entt::type_hash<TType>::value(),
+				.Apply = &ApplyCreate<TType>,
+				.Discard = &Discard<TType>,
+				.Payload = component,
+			});
+		}
+
+		/// @brief Record the destruction of a component.
+		/// @tparam TType Component type.
+		/// @param entity Entity handle.
+		template <typename TType>
+		auto DestroyComponent(CommandTarget entity) -> void
+		{
+			Record(Command{
+				.Kind = Command::Type::Destroy,
+				.Target = entity,
+				.Component = entt::type_hash<TType>::value(),
+				.Apply = &ApplyDestroy<TType>,
+			});
+		}
+
+		/// @brief Check if no commands have been recorded.
+		/// @return @c true if the buffer is empty, @c false otherwise.
+		[[nodiscard]] auto Empty() const -> bool;
+
+	private:
+		friend class CommandQueue;
+
+		struct Command
+		{
+			enum class Type : std::uint8_t
+			{
+				Create,
+				Destroy,
+				DestroyEntity,
+			};
+
+			Type Kind{};
+			CommandTarget Target{Entity{}};
+			entt::id_type Component{};
+			void (*Apply)(EntityManager&, Entity, void*){};
+			void (*Discard)(void*){};
+			void* Payload{};
+		};
+
+		struct Block
+		{
+			std::unique_ptr<std::byte[]> Data{};
+			std::size_t Size{};
+		};
+
+		static constexpr std::size_t BlockSize = std::size_t{64} * 1024;
+
+		template <typename TType>
+		static auto ApplyCreate(EntityManager& entities, Entity entity, void* payload) -> void
+		{
+			entities.CreateComponent<TType>(entity, std::move(*static_cast<TType*>(payload)));
+			Discard<TType>(payload);
+		}
+
+		template <typename TType>
+		static auto ApplyDestroy(EntityManager& entities, Entity entity, [[maybe_unused]] void* payload) -> void
+		{
+			entities.DestroyComponent<TType>(entity);
+		}
+
+		template <typename TType>
+		static auto Discard(void* payload) -> void
+		{
+			static_cast<TType*>(payload)->~TType();
+		}
+
+		[[nodiscard]] auto Allocate(std::size_t size, std::size_t alignment) -> void*;
+
+		auto Record(const Command& command) -> void;
+
+		auto Clear() -> void;
+
+		std::vector<Command> m_Commands{};
+		std::uint32_t m_Created{};
+
+		std::vector<Block> m_Blocks{};
+		std::size_t m_Block{};
+		std::size_t m_Offset{};
+	};
+
+	/// @brief Per-thread command buffers played back at well-defined sync points.
+	/// @details Intended to be published as an entity manager singleton, in which case system groups play it back
+	/// after every stage of their execution plan. Systems updated concurrently can then record structural changes
+	/// without locking, as each job system thread records into a buffer of its own. Threads foreign to the job system
+	/// get a buffer of their own on first use, which is played back after the job system ones.
+	///
+	/// Playback creates pending entities first, then applies component changes sorted by component type and entity,
+	/// and destroys entities last. Repeated changes of the same component on the same entity are coalesced into the
+	/// latest one, ordered by thread index and recording order.
+	class CommandQueue
+	{
+	public:
+		/// @brief Create a command queue.
+		/// @param jobs Job system whose threads record commands, @c nullptr for a single buffer.
+		explicit CommandQueue(const JobSystem* jobs = nullptr);
+
+		/// @brief Get the command buffer of the calling thread.
+		/// @return A reference to the command buffer.
+		[[nodiscard]] auto Local() -> CommandBuffer&;
+
+		/// @brief Check if no commands have been recorded.
+		/// @return @c true if all buffers are empty, @c false otherwise.
+		[[nodiscard]] auto Empty() const -> bool;
+
+		/// @brief Apply and clear all recorded commands.
+		/// @details Must not be called while commands are being recorded.
+		/// @param entities Entity manager to apply the commands to.
+		auto Playback(EntityManager& entities) -> void;
+
+	private:
+		const JobSystem* m_Jobs{};
+		std::deque<CommandBuffer> m_Buffers{};
+
+		// Job system threads index their buffers without locking, so buffers of foreign threads are added without
+		// touching the ones they index. The queue is stored as a singleton, which has to be movable.
+		std::vector<CommandBuffer*> m_Local{};
+		std::vector<std::pair<std::thread::id, CommandBuffer*>> m_Foreign{};
+		std::unique_ptr<std::mutex> m_ForeignMutex{std::make_unique<std::mutex>()};
+	};
+} //namespace Star
@@ -1,19 +1,264 @@
 #include "Entity.hpp"
 
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+	auto Sorted(std::span<const entt::id_type> hashes) -> std::vector<entt::id_type>
+	{
+		std::vector<entt::id_type> sorted{hashes.begin(), hashes.end()};
+		std::ranges::sort(sorted);
+		return sorted;
+	}
+
+	thread_local std::uint64_t t_LastRunTick{};
+} //namespace
+
 namespace Star
 {
+	EntityObserver::EntityObserver(entt::id_type component, ObserverEvent event) :
+		m_Component{component},
+		m_Event{event}
+	{
+	}
+
+	auto EntityObserver::Entities() const -> std::span<const Entity>
+	{
+		return {m_Entities.data(), m_Entities.size()};
+	}
+
+	auto EntityObserver::Empty() const -> bool
+	{
+		return m_Entities.empty();
+	}
+
+	auto EntityObserver::Clear() -> void
+	{
+		m_Entities.clear();
+	}
+
+	auto EntityObserver::Record([[maybe_unused]] EntityRegistry& registry, Entity entity) -> void
+	{
+		if (!m_Entities.contains(entity))
+			m_Entities.push(entity);
+	}
+
+	auto EntityObserver::Drop([[maybe_unused]] EntityRegistry& registry, Entity entity) -> void
+	{
+		m_Entities.remove(entity);
+	}
+
+	EntityManager::EntityManager(const ComponentAllocator& allocator) :
+		EntityRegistry{allocator}
+	{
+	}
+
 	auto EntityManager::Create() -> Entity
 	{
 		return create();
 	}
 
+	auto EntityManager::Create(Entity hint) -> Entity
+	{
+		return create(hint);
+	}
+
+	auto EntityManager::CreateMany(std::span<Entity> entities) -> void
+	{
+		create(entities.begin(), entities.end());
+	}
+
+	auto EntityManager::CreateMany(const Prefab& prefab, std::span<Entity> entities) -> void
+	{
+		CreateMany(entities);
+
+		for (const auto& component : prefab.m_Components)
+			component.Create(*this, entities, component.Value.get());
+	}
+
+	auto EntityManager::CreateMany(const Prefab& prefab, std::size_t count) -> std::vector<Entity>
+	{
+		std::vector<Entity> entities(count);
+		CreateMany(prefab, entities);
+		return entities;
+	}
+
 	auto EntityManager::Destroy(Entity entity) -> void
 	{
+		for (auto remove : m_LaneRemovers)
+			remove(*this, entity);
+
 		destroy(entity);
 	}
 
+	auto EntityManager::DestroyMany(std::span<const Entity> entities) -> void
+	{
+		for (auto remove : m_LaneRemovers)
+		{
+			for (auto entity : entities)
+				remove(*this, entity);
+		}
+
+		destroy(entities.begin(), entities.end());
+	}
+
 	auto EntityManager::Valid(Entity entity) const -> bool
 	{
 		return valid(entity);
 	}
+
+	auto EntityManager::MemoryStats() const -> std::vector<PoolStats>
+	{
+		std::vector<PoolStats> stats{};
+
+		for (auto [type, pool] : storage())
+		{
+			stats.push_back({
+				.Type = type,
+				.Name = pool.type().name(),
+				.Size = pool.size(),
+				.Capacity = pool.capacity(),
+				.Extent = pool.extent(),
+			});
+		}
+
+		return stats;
+	}
+
+	auto EntityManager::Compact() -> void
+	{
+		m_CompactCursor = 0;
+		Compact(std::chrono::nanoseconds::max());
+	}
+
+	auto EntityManager::Compact(std::chrono::nanoseconds budget) -> bool
+	{
+		auto start = std::chrono::steady_clock::now();
+		auto expired = [&, first = true]() mutable {
+			return !std::exchange(first, false) && std::chrono::steady_clock::now() - start >= budget;
+		};
+
+		std::size_t index{};
+		for (auto [type, pool] : storage())
+		{
+			if (index++ < m_CompactCursor)
+				continue;
+
+			if (expired())
+				return false;
+
+			pool.compact();
+			pool.shrink_to_fit();
+			m_CompactCursor = index;
+		}
+
+		for (auto shrink : m_LaneShrinkers)
+		{
+			if (index++ < m_CompactCursor)
+				continue;
+
+			if (expired())
+				return false;
+
+			shrink(*this);
+			m_CompactCursor = index;
+		}
+
+		m_CompactCursor = 0;
+		return true;
+	}
+
+	auto EntityManager::ChangeTick() const -> std::uint64_t
+	{
+		return m_ChangeTick;
+	}
+
+	auto EntityManager::AdvanceChangeTick() -> std::uint64_t
+	{
+		return ++m_ChangeTick;
+	}
+
+	auto EntityManager::LastRunTick() -> std::uint64_t
+	{
+		return t_LastRunTick;
+	}
+
+	auto EntityManager::LastRunTick(std::uint64_t tick) -> void
+	{
+		t_LastRunTick = tick;
+	}
+
+	auto EntityManager::Index(Entity entity) -> std::size_t
+	{
+		return entt::to_entity(entity);
+	}
+
+	auto EntityManager::FromIndex(std::size_t index) const -> Entity
+	{
+		auto entity = static_cast<Entity::entity_type>(index);
+		return entt::entt_traits<Entity>::construct(entity, current(entt::entt_traits<Entity>::construct(entity, 0)));
+	}
+
+	auto EntityManager::CopyComponents(Entity from, Entity to) -> bool
+	{
+		std::vector<entt::basic_sparse_set<Entity>*> copied{};
+
+		for (auto [type, pool] : storage())
+		{
+			if (type == entt::type_hash<Entity>::value() || !pool.contains(from))
+				continue;
+
+			// Storages of types that cannot be copied refuse the value, undo the copies made so far.
+			if (pool.push(to, pool.value(from)) == pool.end())
+			{
+				for (auto* done : copied)
+					done->remove(to);
+
+				return false;
+			}
+
+			copied.push_back(&pool);
+		}
+
+		for (auto copy : m_LaneCopiers)
+			copy(*this, from, to);
+
+		return true;
+	}
+
+	auto EntityManager::OwnsObserver(entt::id_type component, const EntityObserver& observer) const -> bool
+	{
+		return observer.m_Component == component &&
+			std::ranges::any_of(m_Observers, [&](const auto& entry) { return entry.get() == &observer; });
+	}
+
+	auto EntityManager::RegisterGroup(
+		std::span<const entt::id_type> owned,
+		std::span<const entt::id_type> gets,
+		std::span<const entt::id_type> excludes
+	) -> void
+	{
+		GroupSignature signature{
+			.Owned = Sorted(owned),
+			.Gets = Sorted(gets),
+			.Excludes = Sorted(excludes),
+		};
+
+		for (const auto& registered : m_Groups)
+		{
+			if (registered == signature)
+				return;
+
+			if (std::ranges::find_first_of(registered.Owned, signature.Owned) != registered.Owned.end())
+				throw EntityException{"Group owns a component type that is already owned by another group"};
+		}
+
+		m_Groups.push_back(std::move(signature));
+	}
+
+	auto Prefab::Size() const -> std::size_t
+	{
+		return m_Components.size();
+	}
 } //namespace Star
@@ -1,7 +1,27 @@
 #pragma once
 
+#include "Starlight/Runtime/Job.hpp"
+#include "Starlight/Runtime/Lanes.hpp"
+
 #include <entt/entity/registry.hpp>
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 namespace Star
 {
 	/// @brief Entity handle.
@@ -42,18 +62,476 @@ namespace Star
 		entity_type m_Handle{};
 	};
 
+	/// @brief Allocator of the component storage of entity managers.
+	/// @details Polymorphic when built with @c STARLIGHT_PMR_COMPONENTS, so component pools can be backed by a custom
+	/// memory resource, otherwise the default allocator.
+#if defined(STARLIGHT_PMR_COMPONENTS)
+	using ComponentAllocator = std::pmr::polymorphic_allocator<Entity>;
+#else
+	using ComponentAllocator = std::allocator<Entity>;
+#endif
+
+	/// @brief Registry underlying entity managers.
+	using EntityRegistry = entt::basic_registry<Entity, ComponentAllocator>;
+
+	class Prefab;
+
 	template <typename, typename>
 	class EntityView;
 
+	template <typename, typename, typename>
+	class EntityGroup;
+
 	/// @brief A list of component types.
 	/// @tparam TComponents Component types.
 	template <typename... TComponents>
 	class ComponentList
 	{
+	public:
+		/// @brief Component type indices.
+		static constexpr auto Hashes = std::array<entt::id_type, sizeof...(TComponents)>{
+			entt::type_hash<std::remove_const_t<TComponents>>::value()...};
+	};
+
+	/// @brief Check if a type is a component list.
+	/// @tparam T Type to check.
+	template <typename T>
+	struct IsComponentList : std::false_type
+	{
+	};
+
+	/// @brief Check if a type is a component list.
+	/// @tparam TComponents Component types.
+	template <typename... TComponents>
+	struct IsComponentList<ComponentList<TComponents...>> : std::true_type
+	{
+	};
+
+	/// @brief Check if a component records change ticks.
+	/// @details Components opt in by declaring a static @c Tracked member set to @c true.
+	/// @tparam TType Component type.
+	template <typename TType>
+	concept TrackedComponent = requires { requires TType::Tracked; };
+
+	/// @brief Change ticks of a tracked component.
+	/// @tparam TType Component type.
+	template <typename TType>
+	struct ComponentTicks
+	{
+		/// @brief Change tick at which the component was created.
+		std::uint64_t Added{};
+
+		/// @brief Change tick at which the component was last created, replaced or patched.
+		std::uint64_t Changed{};
+	};
+
+	/// @brief View filter including entities whose component changed since the viewing system last ran.
+	/// @tparam TType Tracked component type.
+	template <TrackedComponent TType>
+	struct Changed
+	{
+	};
+
+	/// @brief View filter including entities whose component was added since the viewing system last ran.
+	/// @tparam TType Tracked component type.
+	template <TrackedComponent TType>
+	struct Added
+	{
+	};
+
+	/// @brief Component stored for a type included in a view.
+	/// @tparam TType Included type.
+	template <typename TType>
+	struct ViewComponent
+	{
+		/// @brief Stored component type.
+		using Type = TType;
+
+		/// @brief Check if the included type is a change filter.
+		/// @return Always @c false.
+		[[nodiscard]] static constexpr auto Filtered() -> bool
+		{
+			return false;
+		}
+	};
+
+	/// @brief Component stored for a change filter included in a view.
+	/// @tparam TType Tracked component type.
+	template <typename TType>
+	struct ViewComponent<Changed<TType>>
+	{
+		/// @brief Stored component type.
+		using Type = const ComponentTicks<std::remove_const_t<TType>>;
+
+		/// @brief Check if the included type is a change filter.
+		/// @return Always @c true.
+		[[nodiscard]] static constexpr auto Filtered() -> bool
+		{
+			return true;
+		}
+
+		/// @brief Check if an entity passes the filter.
+		/// @param ticks Change ticks of the component.
+		/// @param lastRun Change tick at which the viewing system last ran.
+		/// @return @c true if the component changed after @p lastRun, @c false otherwise.
+		[[nodiscard]] static auto Passes(const ComponentTicks<std::remove_const_t<TType>>& ticks, std::uint64_t lastRun)
+			-> bool
+		{
+			return ticks.Changed > lastRun;
+		}
+	};
+
+	/// @brief Component stored for an addition filter included in a view.
+	/// @tparam TType Tracked component type.
+	template <typename TType>
+	struct ViewComponent<Added<TType>>
+	{
+		/// @brief Stored component type.
+		using Type = const ComponentTicks<std::remove_const_t<TType>>;
+
+		/// @brief Check if the included type is a change filter.
+		/// @return Always @c true.
+		[[nodiscard]] static constexpr auto Filtered() -> bool
+		{
+			return true;
+		}
+
+		/// @brief Check if an entity passes the filter.
+		/// @param ticks Change ticks of the component.
+		/// @param lastRun Change tick at which the viewing system last ran.
+		/// @return @c true if the component was added after @p lastRun, @c false otherwise.
+		[[nodiscard]] static auto Passes(const ComponentTicks<std::remove_const_t<TType>>& ticks, std::uint64_t lastRun)
+			-> bool
+		{
+			return ticks.Added > lastRun;
+		}
+	};
+
+	/// @brief Component stored for a filter included in a const view.
+	/// @tparam TType Filter type.
+	template <typename TType>
+	requires(ViewComponent<TType>::Filtered())
+	struct ViewComponent<const TType> : ViewComponent<TType>
+	{
+	};
+
+	template <typename TType, typename TLanes = typename TType::Lanes>
+	class LaneStorage;
+
+	/// @brief Structure-of-arrays storage of a component.
+	/// @details Every scalar of the listed members is stored in a lane of its own, ordered like the entities of the
+	/// storage. Lanes are aligned and zero padded to the SIMD width, so kernels can process whole registers without
+	/// handling a remainder. Removing an entity moves the last entity into its place.
+	/// @tparam TType Component type.
+	/// @tparam TMembers Pointers to the stored members.
+	template <typename TType, auto... TMembers>
+	class LaneStorage<TType, LaneList<TMembers...>>
+	{
+	private:
+		template <typename>
+		struct MemberTraits;
+
+		template <typename TValue>
+		struct MemberTraits<TValue TType::*> : LaneTraits<TValue>
+		{
+		};
+
+		template <std::size_t TMember>
+		using Member = MemberTraits<std::tuple_element_t<TMember, std::tuple<decltype(TMembers)...>>>;
+
+	public:
+		/// @brief Scalar type of the lanes of a member.
+		/// @tparam TMember Index of the member in the lane list.
+		template <std::size_t TMember>
+		using Scalar = typename Member<TMember>::Scalar;
+
+		/// @brief Get the number of entities in the storage.
+		/// @return Number of entities.
+		[[nodiscard]] auto Size() const -> std::size_t
+		{
+			return m_Entities.size();
+		}
+
+		/// @brief Get the entities in the storage.
+		/// @return Entities ordered like the lanes.
+		[[nodiscard]] auto Entities() const -> std::span<const Entity>
+		{
+			return {m_Entities.data(), m_Entities.size()};
+		}
+
+		/// @brief Check if an entity is contained in the storage.
+		/// @param entity Valid entity handle.
+		/// @return @c true if the entity is contained, @c false otherwise.
+		[[nodiscard]] auto Contains(Entity entity) const -> bool
+		{
+			return m_Entities.contains(entity);
+		}
+
+		/// @brief Get the index of an entity in the lanes.
+		/// @param entity Entity handle contained in the storage.
+		/// @return Index of the entity.
+		[[nodiscard]] auto Index(Entity entity) const -> std::size_t
+		{
+			return m_Entities.index(entity);
+		}
+
+		/// @brief Insert a component, replacing it if it exists.
+		/// @param entity Valid entity handle.
+		/// @param value Component value.
+		auto Insert(Entity entity, TType value) -> void
+		{
+			if (!m_Entities.contains(entity))
+			{
+				m_Entities.push(entity);
+				Resize();
+			}
+
+			Store(m_Entities.index(entity), value, std::index_sequence_for<decltype(TMembers)...>{});
+		}
+
+		/// @brief Remove a component.
+		/// @param entity Valid entity handle.
+		/// @return @c true if the component was removed, @c false otherwise.
+		auto Remove(Entity entity) -> bool
+		{
+			if (!m_Entities.contains(entity))
+				return false;
+
+			Erase(m_Entities.index(entity), m_Entities.size() - 1, std::index_sequence_for<decltype(TMembers)...>{});
+			m_Entities.erase(entity);
+			Resize();
+
+			return true;
+		}
+
+		/// @brief Remove all components.
+		auto Clear() -> void
+		{
+			m_Entities.clear();
+			Resize();
+		}
+
+		/// @brief Release the unused capacity of the entities and lanes.
+		auto ShrinkToFit() -> void
+		{
+			m_Entities.shrink_to_fit();
+
+			std::apply(
+				[](auto&... members) {
+					(std::ranges::for_each(members, [](auto& lane) { lane.shrink_to_fit(); }), ...);
+				},
+				m_Lanes
+			);
+		}
+
+		/// @brief Gather a component from its lanes.
+		/// @param entity Entity handle contained in the storage.
+		/// @return A copy of the component.
+		[[nodiscard]] auto Get(Entity entity) const -> TType
+		{
+			TType value{};
+			Load(m_Entities.index(entity), value, std::index_sequence_for<decltype(TMembers)...>{});
+			return value;
+		}
+
+		/// @brief Get a lane of a member.
+		/// @tparam TMember Index of the member in the lane list.
+		/// @tparam TLane Index of the scalar in the member.
+		/// @return Scalars of all entities, zero padded to a multiple of the SIMD width.
+		template <std::size_t TMember, std::size_t TLane = 0>
+		[[nodiscard]] auto Lane() -> std::span<Scalar<TMember>>
+		{
+			static_assert(TLane < Member<TMember>::Count);
+			return std::get<TMember>(m_Lanes)[TLane];
+		}
+
+		/// @brief Get a lane of a member.
+		/// @tparam TMember Index of the member in the lane list.
+		/// @tparam TLane Index of the scalar in the member.
+		/// @return Scalars of all entities, zero padded to a multiple of the SIMD width.
+		template <std::size_t TMember, std::size_t TLane = 0>
+		[[nodiscard]] auto Lane() const -> std::span<const Scalar<TMember>>
+		{
+			static_assert(TLane < Member<TMember>::Count);
+			return std::get<TMember>(m_Lanes)[TLane];
+		}
+
+	private:
+		template <std::size_t TMember>
+		using LaneVector = std::vector<Scalar<TMember>, LaneAllocator<Scalar<TMember>>>;
+
+		template <std::size_t TMember>
+		using MemberLanes = std::array<LaneVector<TMember>, Member<TMember>::Count>;
+
+		template <std::size_t... TIndices>
+		static auto MakeLanes(std::index_sequence<TIndices...>) -> std::tuple<MemberLanes<TIndices>...>;
+
+		auto Resize() -> void
+		{
+			std::apply(
+				[&](auto&... members) {
+					(ResizeMember(members), ...);
+				},
+				m_Lanes
+			);
+		}
+
+		template <typename TLanes>
+		auto ResizeMember(TLanes& lanes) -> void
+		{
+			using TScalar = typename TLanes::value_type::value_type;
+			auto padded = (m_Entities.size() + SimdLanes<TScalar> - 1) / SimdLanes<TScalar> * SimdLanes<TScalar>;
+
+			for (auto& lane : lanes)
+				lane.resize(padded);
+		}
+
+		template <std::size_t... TIndices>
+		auto Store(std::size_t index, TType& value, std::index_sequence<TIndices...>) -> void
+		{
+			(StoreMember<TIndices>(index, value), ...);
+		}
+
+		template <std::size_t TMember>
+		auto StoreMember(std::size_t index, TType& value) -> void
+		{
+			auto& member = value.*std::get<TMember>(LaneList<TMembers...>::Members);
+			for (std::size_t lane = 0; lane < Member<TMember>::Count; ++lane)
+				std::get<TMember>(m_Lanes)[lane][index] = Member<TMember>::Get(member, lane);
+		}
+
+		template <std::size_t... TIndices>
+		auto Load(std::size_t index, TType& value, std::index_sequence<TIndices...>) const -> void
+		{
+			(LoadMember<TIndices>(index, value), ...);
+		}
+
+		template <std::size_t TMember>
+		auto LoadMember(std::size_t index, TType& value) const -> void
+		{
+			auto& member = value.*std::get<TMember>(LaneList<TMembers...>::Members);
+			for (std::size_t lane = 0; lane < Member<TMember>::Count; ++lane)
+				Member<TMember>::Get(member, lane) = std::get<TMember>(m_Lanes)[lane][index];
+		}
+
+		template <std::size_t... TIndices>
+		auto Erase(std::size_t index, std::size_t last, std::index_sequence<TIndices...>) -> void
+		{
+			(EraseMember<TIndices>(index, last), ...);
+		}
+
+		template <std::size_t TMember>
+		auto EraseMember(std::size_t index, std::size_t last) -> void
+		{
+			// Padding has to stay zeroed, so the vacated slot is cleared after moving the last entity into place.
+			for (auto& lane : std::get<TMember>(m_Lanes))
+			{
+				lane[index] = lane[last];
+				lane[last] = {};
+			}
+		}
+
+		entt::basic_sparse_set<Entity> m_Entities{};
+		decltype(MakeLanes(std::index_sequence_for<decltype(TMembers)...>{})) m_Lanes{};
+	};
+
+	/// @brief Component change recorded by an entity observer.
+	enum class ObserverEvent : std::uint8_t
+	{
+		/// @brief The component was created on an entity that did not have it.
+		Created,
+
+		/// @brief The component was replaced on an entity that already had it.
+		Replaced,
+
+		/// @brief The component was destroyed.
+		Destroyed,
+	};
+
+	/// @brief Deduplicated batch of entities affected by changes of a component.
+	/// @details Every affected entity is recorded once until the batch is cleared, so that a system can process all
+	/// changes since it last cleared the batch in one loop instead of reacting to every change individually.
+	/// Observers of created and replaced components drop entities whose component is destroyed before the batch is
+	/// cleared. Batches of destroyed components may contain entities that are no longer valid.
+	class EntityObserver
+	{
+	public:
+		/// @brief Create an entity observer.
+		/// @param component Type index of the observed component.
+		/// @param event Observed component change.
+		EntityObserver(entt::id_type component, ObserverEvent event);
+
+		/// @brief Copy constructor.
+		/// @param other Entity observer to copy from.
+		EntityObserver(const EntityObserver& other) = delete;
+
+		/// @brief Move constructor.
+		/// @param other Entity observer to move from.
+		EntityObserver(EntityObserver&& other) = delete;
+
+		/// @brief Copy operator.
+		/// @param other Entity observer to copy from.
+		/// @return Reference to the current entity observer.
+		auto operator=(const EntityObserver& other) -> EntityObserver& = delete;
+
+		/// @brief Move operator.
+		/// @param other Entity observer to move from.
+		/// @return Reference to the current entity observer.
+		auto operator=(EntityObserver&& other) -> EntityObserver& = delete;
+
+		/// @brief Destructor.
+		~EntityObserver() = default;
+
+		/// @brief Get the recorded entities.
+		/// @return Entities in recording order, until the batch is cleared or an entity is dropped.
+		[[nodiscard]] auto Entities() const -> std::span<const Entity>;
+
+		/// @brief Check if no entities have been recorded.
+		/// @return @c true if the batch is empty, @c false otherwise.
+		[[nodiscard]] auto Empty() const -> bool;
+
+		/// @brief Clear the recorded entities.
+		auto Clear() -> void;
+
+	private:
+		friend class EntityManager;
+
+		auto Record(EntityRegistry& registry, Entity entity) -> void;
+
+		auto Drop(EntityRegistry& registry, Entity entity) -> void;
+
+		entt::id_type m_Component{};
+		ObserverEvent m_Event{};
+		entt::basic_sparse_set<Entity> m_Entities{};
+	};
+
+	/// @brief Memory statistics of a component storage.
+	struct PoolStats
+	{
+		/// @brief Type index of the stored type.
+		entt::id_type Type{};
+
+		/// @brief Name of the stored type.
+		std::string_view Name{};
+
+		/// @brief Number of stored entities.
+		std::size_t Size{};
+
+		/// @brief Number of entities that fit into the dense arrays without reallocating.
+		std::size_t Capacity{};
+
+		/// @brief Number of entity indices covered by the sparse pages.
+		std::size_t Extent{};
+	};
+
+	/// @brief Exception raised when an entity specific error happens.
+	struct EntityException : std::runtime_error
+	{
+		using runtime_error::runtime_error;
 	};
 
 	/// @brief Entity and component manager.
-	class EntityManager : entt::basic_registry<Entity>
+	class EntityManager : EntityRegistry
 	{
 	public:
 		/// @brief Storage type used for a specific component.
@@ -61,29 +539,152 @@ namespace Star
 		template <typename TType>
 		using Storage = storage_for_type<TType>;
 
+		/// @brief Create an entity manager.
+		EntityManager() = default;
+
+		/// @brief Create an entity manager allocating its component storage from a specific allocator.
+		/// @param allocator Allocator of the component storage.
+		explicit EntityManager(const ComponentAllocator& allocator);
+
 		/// @brief Create a new entity.
 		/// @return A valid entity handle.
 		[[nodiscard]] auto Create() -> Entity;
 
+		/// @brief Create a new entity, reusing a specific handle if it is free.
+		/// @param hint Entity handle to reuse.
+		/// @return A valid entity handle, equal to @p hint unless the handle is in use.
+		[[nodiscard]] auto Create(Entity hint) -> Entity;
+
+		/// @brief Create new entities.
+		/// @param entities Span receiving the valid entity handles.
+		auto CreateMany(std::span<Entity> entities) -> void;
+
+		/// @brief Create new entities from a prefab.
+		/// @details Each component of the prefab is inserted into its storage as a single range.
+		/// @param prefab Prefab whose components are copied to every entity.
+		/// @param entities Span receiving the valid entity handles.
+		auto CreateMany(const Prefab& prefab, std::span<Entity> entities) -> void;
+
+		/// @brief Create new entities from a prefab.
+		/// @param prefab Prefab whose components are copied to every entity.
+		/// @param count Number of entities to create.
+		/// @return Valid entity handles.
+		[[nodiscard]] auto CreateMany(const Prefab& prefab, std::size_t count) -> std::vector<Entity>;
+
 		/// @brief Destroy an entity.
 		/// @param entity A valid entity handle.
 		auto Destroy(Entity entity) -> void;
 
+		/// @brief Destroy entities.
+		/// @param entities Valid entity handles.
+		auto DestroyMany(std::span<const Entity> entities) -> void;
+
 		/// @brief Check if an entity is valid.
 		/// @param entity An entity handle.
 		/// @return @c true if the entity is valid, @c false otherwise.
 		[[nodiscard]] auto Valid(Entity entity) const -> bool;
 
 		/// @brief Create a component on an entity.
+		/// @details Lane components are scattered into their lane storage instead. Tracked components are marked as
+		/// changed, and as added unless they are replaced.
 		/// @tparam TType Component type.
 		/// @tparam TArgs Component constructor argument types.
 		/// @param entity Valid entity handle.
 		/// @param args Component constructor arguments.
-		/// @return A reference to the created component.
+		/// @return A reference to the created component, nothing for lane components.
 		template <typename TType, typename... TArgs>
-		auto CreateComponent(Entity entity, TArgs&&... args) -> TType&
+		auto CreateComponent(Entity entity, TArgs&&... args) -> decltype(auto)
+		{
+			if constexpr (TrackedComponent<TType>)
+			{
+				if (auto* ticks = try_get<ComponentTicks<TType>>(entity))
+					ticks->Changed = m_ChangeTick;
+				else
+					emplace<ComponentTicks<TType>>(entity, m_ChangeTick, m_ChangeTick);
+			}
+
+			if constexpr (LaneComponent<TType>)
+			{
+				if constexpr (std::is_aggregate_v<TType>)
+					Lanes<TType>().Insert(entity, TType{std::forward<TArgs>(args)...});
+				else
+					Lanes<TType>().Insert(entity, TType(std::forward<TArgs>(args)...));
+			}
+			else
+				return emplace_or_replace<TType>(entity, std::forward<TArgs>(args)...);
+		}
+
+		/// @brief Create a component on a range of entities.
+		/// @details Non-lane components are inserted into their storage as a single range. Tracked components are
+		/// marked as added and changed.
+		/// @tparam TType Component type.
+		/// @param entities Valid entity handles without the component.
+		/// @param components Components to copy, in the order of @p entities.
+		template <typename TType>
+		requires(!std::is_empty_v<TType>)
+		auto CreateComponents(std::span<const Entity> entities, std::span<const TType> components) -> void
+		{
+			CreateTicks<TType>(entities);
+
+			if constexpr (LaneComponent<TType>)
+			{
+				for (std::size_t i = 0; i < entities.size(); ++i)
+					Lanes<TType>().Insert(entities[i], components[i]);
+			}
+			else
+			{
+				ReserveComponents<TType>(entities.size());
+				insert<TType>(entities.begin(), entities.end(), components.begin());
+			}
+		}
+
+		/// @brief Create copies of a component on a range of entities.
+		/// @details Non-lane components are inserted into their storage as a single range. Tracked components are
+		/// marked as added and changed.
+		/// @tparam TType Component type.
+		/// @param entities Valid entity handles without the component.
+		/// @param component Component to copy to every entity.
+		template <typename TType>
+		auto CreateComponents(std::span<const Entity> entities, const TType& component = {}) -> void
+		{
+			CreateTicks<TType>(entities);
+
+			if constexpr (LaneComponent<TType>)
+			{
+				for (auto entity : entities)
+					Lanes<TType>().Insert(entity, component);
+			}
+			else
+			{
+				ReserveComponents<TType>(entities.size());
+				insert<TType>(entities.begin(), entities.end(), component);
+			}
+		}
+
+		/// @brief Reserve storage for additional components.
+		/// @details Lane storage grows on demand and is not reserved.
+		/// @tparam TType Component type.
+		/// @param count Number of components to reserve storage for, in addition to the existing ones.
+		template <typename TType>
+		auto ReserveComponents(std::size_t count) -> void
+		{
+			if constexpr (!LaneComponent<TType>)
+			{
+				auto& components = storage<TType>();
+				components.reserve(components.size() + count);
+			}
+		}
+
+		/// @brief Create the storages of components ahead of their first use.
+		/// @details Storages are otherwise created on first use, which inserts into the entity manager and must not
+		/// happen while other threads access it. Change tick storages of tracked components are created as well.
+		/// Types published as singletons and types that cannot be stored as components are skipped.
+		/// @tparam TComponents Component types, change filters are resolved to their change tick storage.
+		/// @param components Component types.
+		template <typename... TComponents>
+		auto CreateStorages([[maybe_unused]] ComponentList<TComponents...> components) -> void
 		{
-			return emplace_or_replace<TType>(entity, std::forward<TArgs>(args)...);
+			(CreateStorage<std::remove_const_t<typename ViewComponent<TComponents>::Type>>(), ...);
 		}
 
 		/// @brief Destroy a component on an entity.
@@ -93,7 +694,54 @@ namespace Star
 		template <typename TType>
 		auto DestroyComponent(Entity entity) -> bool
 		{
-			return remove<TType>(entity) > 0;
+			if constexpr (TrackedComponent<TType>)
+				remove<ComponentTicks<TType>>(entity);
+
+			if constexpr (LaneComponent<TType>)
+				return Lanes<TType>().Remove(entity);
+			else
+				return remove<TType>(entity) > 0;
+		}
+
+		/// @brief Destroy a component on a range of entities.
+		/// @tparam TType Component type.
+		/// @param entities Valid entity handles.
+		/// @return Number of destroyed components.
+		template <typename TType>
+		auto DestroyComponents(std::span<const Entity> entities) -> std::size_t
+		{
+			if constexpr (TrackedComponent<TType>)
+				remove<ComponentTicks<TType>>(entities.begin(), entities.end());
+
+			if constexpr (LaneComponent<TType>)
+				return static_cast<std::size_t>(std::ranges::count_if(entities, [&](Entity entity) {
+					return Lanes<TType>().Remove(entity);
+				}));
+			else
+				return remove<TType>(entities.begin(), entities.end());
+		}
+
+		/// @brief Get a tracked component on an entity for modification, marking it as changed.
+		/// @details Safe to call concurrently for different entities.
+		/// @tparam TType Tracked component type.
+		/// @param entity Valid entity handle.
+		/// @return A reference to the component.
+		template <TrackedComponent TType>
+		requires(!LaneComponent<TType>)
+		[[nodiscard]] auto PatchComponent(Entity entity) -> TType&
+		{
+			MarkChanged<TType>(entity);
+			return get<TType>(entity);
+		}
+
+		/// @brief Mark a tracked component on an entity as changed.
+		/// @details Intended for components modified through views. Safe to call concurrently for different entities.
+		/// @tparam TType Tracked component type.
+		/// @param entity Valid entity handle with the component.
+		template <TrackedComponent TType>
+		auto MarkChanged(Entity entity) -> void
+		{
+			get<ComponentTicks<TType>>(entity).Changed = m_ChangeTick;
 		}
 
 		/// @brief Check if a component exists on an entity.
@@ -103,27 +751,36 @@ namespace Star
 		template <typename TType>
 		[[nodiscard]] auto HasComponent(Entity entity) const -> bool
 		{
-			return all_of<TType>(entity);
+			if constexpr (LaneComponent<TType>)
+				return ctx().contains<LaneStorage<TType>>() && ctx().get<LaneStorage<TType>>().Contains(entity);
+			else
+				return all_of<TType>(entity);
 		}
 
 		/// @brief Get a component on an entity.
 		/// @tparam TType Component type.
 		/// @param entity Valid entity handle.
-		/// @return A reference to the component.
+		/// @return A reference to the component, a copy gathered from the lanes for lane components.
 		template <typename TType>
-		[[nodiscard]] auto GetComponent(Entity entity) -> TType&
+		[[nodiscard]] auto GetComponent(Entity entity) -> decltype(auto)
 		{
-			return get<TType>(entity);
+			if constexpr (LaneComponent<TType>)
+				return Lanes<TType>().Get(entity);
+			else
+				return get<TType>(entity);
 		}
 
 		/// @brief Get a component on an entity.
 		/// @tparam TType Component type.
 		/// @param entity Valid entity handle.
-		/// @return A reference to the component.
+		/// @return A reference to the component, a copy gathered from the lanes for lane components.
 		template <typename TType>
-		[[nodiscard]] auto GetComponent(Entity entity) const -> const TType&
+		[[nodiscard]] auto GetComponent(Entity entity) const -> decltype(auto)
 		{
-			return get<TType>(entity);
+			if constexpr (LaneComponent<TType>)
+				return ctx().get<LaneStorage<TType>>().Get(entity);
+			else
+				return get<TType>(entity);
 		}
 
 		/// @brief Clear a component on all entities.
@@ -131,7 +788,41 @@ namespace Star
 		template <typename TType>
 		auto ClearComponent() -> void
 		{
-			clear<TType>();
+			if constexpr (TrackedComponent<TType>)
+				clear<ComponentTicks<TType>>();
+
+			if constexpr (LaneComponent<TType>)
+				Lanes<TType>().Clear();
+			else
+				clear<TType>();
+		}
+
+		/// @brief Get the structure-of-arrays storage of a lane component.
+		/// @details Lane components are not part of entity views and groups. Systems iterate the entities of the
+		/// storage instead, processing the lanes of a member in SIMD width steps.
+		/// @tparam TType Lane component type.
+		/// @return A reference to the storage, created on first use.
+		template <LaneComponent TType>
+		[[nodiscard]] auto Lanes() -> LaneStorage<TType>&
+		{
+			if (ctx().contains<LaneStorage<TType>>())
+				return ctx().get<LaneStorage<TType>>();
+
+			m_LaneRemovers.push_back([](EntityManager& entities, Entity entity) {
+				entities.ctx().get<LaneStorage<TType>>().Remove(entity);
+			});
+
+			m_LaneShrinkers.push_back([](EntityManager& entities) {
+				entities.ctx().get<LaneStorage<TType>>().ShrinkToFit();
+			});
+
+			m_LaneCopiers.push_back([](EntityManager& entities, Entity from, Entity to) {
+				auto& lanes = entities.ctx().get<LaneStorage<TType>>();
+				if (lanes.Contains(from))
+					lanes.Insert(to, lanes.Get(from));
+			});
+
+			return ctx().emplace<LaneStorage<TType>>();
 		}
 
 		/// @brief Create a singleton.
@@ -182,9 +873,11 @@ namespace Star
 		}
 
 		/// @brief Create a view on entities with specific components.
-		/// @tparam TIncludes Component types to include in the view.
+		/// @details Included @c Changed and @c Added filters compare against the change tick at which the calling
+		/// system last ran.
+		/// @tparam TIncludes Component types and change filters to include in the view.
 		/// @tparam TExcludes Component types to exclude from the view.
-		/// @param includes Component types to include in the view.
+		/// @param includes Component types and change filters to include in the view.
 		/// @param excludes Component types to exclude from the view.
 		/// @return A view on the selected entities.
 		template <typename... TIncludes, typename... TExcludes>
@@ -193,13 +886,15 @@ namespace Star
 			[[maybe_unused]] ComponentList<TExcludes...> excludes
 		) -> EntityView<ComponentList<TIncludes...>, ComponentList<TExcludes...>>
 		{
-			return {view<TIncludes...>(entt::exclude<TExcludes...>)};
+			return {view<typename ViewComponent<TIncludes>::Type...>(entt::exclude<TExcludes...>), LastRunTick()};
 		}
 
 		/// @brief Create a view on entities with specific components.
-		/// @tparam TIncludes Component types to include in the view.
+		/// @details Included @c Changed and @c Added filters compare against the change tick at which the calling
+		/// system last ran.
+		/// @tparam TIncludes Component types and change filters to include in the view.
 		/// @tparam TExcludes Component types to exclude from the view.
-		/// @param includes Component types to include in the view.
+		/// @param includes Component types and change filters to include in the view.
 		/// @param excludes Component types to exclude from the view.
 		/// @return A view on the selected entities.
 		template <typename... TIncludes, typename... TExcludes>
@@ -208,8 +903,351 @@ namespace Star
 			[[maybe_unused]] ComponentList<TExcludes...> excludes
 		) const -> EntityView<ComponentList<const TIncludes...>, ComponentList<const TExcludes...>>
 		{
-			return {view<TIncludes...>(entt::exclude<TExcludes...>)};
+			return {view<typename ViewComponent<TIncludes>::Type...>(entt::exclude<TExcludes...>), LastRunTick()};
+		}
+
+		/// @brief Create an observer batching changes of a component.
+		/// @details Every call creates an observer of its own, so every caller clears its batch independently of
+		/// other callers observing the same change. The observer is owned by the entity manager until it is passed
+		/// to @c Unobserve. It is connected to the signals of the component storage, changes made concurrently must
+		/// not be observed.
+		/// @tparam TType Component type, must not be a lane component.
+		/// @param event Observed component change.
+		/// @return A reference to the new observer.
+		template <typename TType>
+		requires(!LaneComponent<TType>)
+		[[nodiscard]] auto Observe(ObserverEvent event) -> EntityObserver&
+		{
+			auto component = entt::type_hash<TType>::value();
+			auto& observer = *m_Observers.emplace_back(std::make_unique<EntityObserver>(component, event));
+			switch (event)
+			{
+			case ObserverEvent::Created:
+				on_construct<TType>().template connect<&EntityObserver::Record>(observer);
+				on_destroy<TType>().template connect<&EntityObserver::Drop>(observer);
+				break;
+
+			case ObserverEvent::Replaced:
+				on_update<TType>().template connect<&EntityObserver::Record>(observer);
+				on_destroy<TType>().template connect<&EntityObserver::Drop>(observer);
+				break;
+
+			case ObserverEvent::Destroyed:
+				on_destroy<TType>().template connect<&EntityObserver::Record>(observer);
+				break;
+			}
+
+			return observer;
+		}
+
+		/// @brief Disconnect and destroy an observer batching changes of a component.
+		/// @tparam TType Component type.
+		/// @param observer Observer created by @c Observe for the same component type.
+		/// @return @c true if the observer was destroyed, @c false otherwise.
+		template <typename TType>
+		requires(!LaneComponent<TType>)
+		auto Unobserve(EntityObserver& observer) -> bool
+		{
+			if (!OwnsObserver(entt::type_hash<TType>::value(), observer))
+				return false;
+
+			on_construct<TType>().disconnect(&observer);
+			on_update<TType>().disconnect(&observer);
+			on_destroy<TType>().disconnect(&observer);
+
+			std::erase_if(m_Observers, [&](const auto& entry) { return entry.get() == &observer; });
+			return true;
 		}
+
+		/// @brief Get the memory statistics of all component storages.
+		/// @details Includes the storages of entities, change ticks and observers, but not lane storages.
+		/// @return Statistics of every storage.
+		[[nodiscard]] auto MemoryStats() const -> std::vector<PoolStats>;
+
+		/// @brief Release the unused memory of all component storages.
+		/// @details Removes the tombstones of pointer stable storages and shrinks the dense arrays to their current
+		/// contents. Intended after mass destruction, like unloading a level.
+		///
+		/// Sparse pages stay allocated for the lifetime of their storage, since entt only releases them together
+		/// with the storage. The free list of the entity storage is kept as well, as it holds the versions that keep
+		/// handles of destroyed entities invalid. @c Renumber moves entities to low indices instead, so fewer sparse
+		/// pages are touched and storages created later allocate fewer of them.
+		auto Compact() -> void;
+
+		/// @brief Release the unused memory of component storages within a time budget.
+		/// @details Storages are compacted one after another, continuing with the next storage on the following
+		/// call. At least one storage is compacted per call, so a single large storage may exceed the budget.
+		/// @param budget Time after which no further storage is compacted.
+		/// @return @c true if all storages have been compacted since the pass started, @c false otherwise.
+		auto Compact(std::chrono::nanoseconds budget) -> bool;
+
+		/// @brief Move entities to the lowest free entity indices.
+		/// @details Entities with an index at or above the number of entities with one of the listed components are
+		/// recreated at a free lower index, so iterating the entities touches fewer sparse pages and storages created
+		/// later allocate fewer of them. All components of a moved entity are copied, including components that are
+		/// not listed, before the original entity is destroyed. Entities with a component that cannot be copied are
+		/// not moved. Recreated entities take the current version of their index, so handles of the entity that
+		/// previously used the index stay invalid. Components referencing moved entities have to be patched by the
+		/// caller using the returned mapping.
+		/// @tparam TComponents Component types selecting the entities to move.
+		/// @param components Component types selecting the entities to move.
+		/// @return Pairs of old and new handles of the moved entities.
+		template <typename... TComponents>
+		auto Renumber([[maybe_unused]] ComponentList<TComponents...> components)
+			-> std::vector<std::pair<Entity, Entity>>
+		{
+			std::vector<Entity> entities{};
+			(AppendEntities<TComponents>(entities), ...);
+
+			std::ranges::sort(entities);
+			entities.erase(std::ranges::unique(entities).begin(), entities.end());
+
+			std::vector<bool> used(entities.size());
+			for (auto entity : entities)
+			{
+				if (Index(entity) < used.size())
+					used[Index(entity)] = true;
+			}
+
+			std::vector<std::pair<Entity, Entity>> moved{};
+			std::size_t index{};
+
+			for (auto entity : entities)
+			{
+				if (Index(entity) < used.size())
+					continue;
+
+				auto target = Entity{};
+				for (; !target && index < used.size(); ++index)
+				{
+					if (used[index])
+						continue;
+
+					// The index may be taken by an entity without any of the listed components.
+					target = Create(FromIndex(index));
+					if (Index(target) != index)
+					{
+						Destroy(target);
+						target = Entity{};
+					}
+				}
+
+				if (!target)
+					break;
+
+				// The index stays free for the next entity.
+				if (!CopyComponents(entity, target))
+				{
+					Destroy(target);
+					--index;
+					continue;
+				}
+
+				Destroy(entity);
+				moved.emplace_back(entity, target);
+			}
+
+			return moved;
+		}
+
+		/// @brief Get the current change tick.
+		/// @return Change tick recorded for components created or patched now.
+		[[nodiscard]] auto ChangeTick() const -> std::uint64_t;
+
+		/// @brief Advance the change tick.
+		/// @details System groups advance the tick before every stage and after every stage, before structural
+		/// changes are played back. Must not be called while components are created or patched concurrently.
+		/// @return The new change tick.
+		auto AdvanceChangeTick() -> std::uint64_t;
+
+		/// @brief Get the change tick at which the system updating on the calling thread last ran.
+		/// @return Change tick, @c 0 outside of system updates.
+		[[nodiscard]] static auto LastRunTick() -> std::uint64_t;
+
+		/// @brief Set the change tick at which the system updating on the calling thread last ran.
+		/// @param tick Change tick.
+		static auto LastRunTick(std::uint64_t tick) -> void;
+
+		/// @brief Create a group on entities with specific components.
+		/// @details Owned components are kept sorted in lock-step, so that the components of the entities in the
+		/// group are packed at the front of their storages at matching indices. A component type can only be owned
+		/// by a single group, requesting the same group again returns the existing one. Owned storages must not be
+		/// sorted by other means afterwards.
+		/// @tparam TOwned Component types owned by the group.
+		/// @tparam TGets Component types included in the group, but not owned.
+		/// @tparam TExcludes Component types to exclude from the group.
+		/// @param owned Component types owned by the group.
+		/// @param gets Component types included in the group, but not owned.
+		/// @param excludes Component types to exclude from the group.
+		/// @throws EntityException If a component type is already owned by a different group.
+		/// @return A group on the selected entities.
+		template <typename... TOwned, typename... TGets, typename... TExcludes>
+			requires(sizeof...(TOwned) > 0)
+		[[nodiscard]] auto Group(
+			[[maybe_unused]] ComponentList<TOwned...> owned,
+			[[maybe_unused]] ComponentList<TGets...> gets,
+			[[maybe_unused]] ComponentList<TExcludes...> excludes
+		) -> EntityGroup<ComponentList<TOwned...>, ComponentList<TGets...>, ComponentList<TExcludes...>>
+		{
+			RegisterGroup(
+				ComponentList<TOwned...>::Hashes,
+				ComponentList<TGets...>::Hashes,
+				ComponentList<TExcludes...>::Hashes
+			);
+
+			return {
+				group<TOwned...>(entt::get<TGets...>, entt::exclude<TExcludes...>),
+				&storage<std::remove_const_t<TOwned>>()...,
+			};
+		}
+
+	private:
+		struct GroupSignature
+		{
+			std::vector<entt::id_type> Owned{};
+			std::vector<entt::id_type> Gets{};
+			std::vector<entt::id_type> Excludes{};
+
+			[[nodiscard]] friend auto operator==(const GroupSignature&, const GroupSignature&) -> bool = default;
+		};
+
+		auto RegisterGroup(
+			std::span<const entt::id_type> owned,
+			std::span<const entt::id_type> gets,
+			std::span<const entt::id_type> excludes
+		) -> void;
+
+		[[nodiscard]] auto OwnsObserver(entt::id_type component, const EntityObserver& observer) const -> bool;
+
+		[[nodiscard]] static auto Index(Entity entity) -> std::size_t;
+
+		[[nodiscard]] auto FromIndex(std::size_t index) const -> Entity;
+
+		auto CopyComponents(Entity from, Entity to) -> bool;
+
+		template <typename TType>
+		auto AppendEntities(std::vector<Entity>& entities) -> void
+		{
+			if constexpr (LaneComponent<TType>)
+			{
+				auto stored = Lanes<TType>().Entities();
+				entities.insert(entities.end(), stored.begin(), stored.end());
+			}
+			else
+			{
+				for (auto entity : View(ComponentList<const TType>{}, ComponentList<>{}))
+					entities.push_back(entity);
+			}
+		}
+
+		template <typename TType>
+		auto CreateStorage() -> void
+		{
+			if constexpr (LaneComponent<TType>)
+				static_cast<void>(Lanes<TType>());
+			else if constexpr (std::movable<TType>)
+			{
+				if (HasSingleton<TType>())
+					return;
+
+				static_cast<void>(storage<TType>());
+
+				if constexpr (TrackedComponent<TType>)
+					static_cast<void>(storage<ComponentTicks<TType>>());
+			}
+		}
+
+		template <typename TType>
+		auto CreateTicks(std::span<const Entity> entities) -> void
+		{
+			if constexpr (TrackedComponent<TType>)
+			{
+				ReserveComponents<ComponentTicks<TType>>(entities.size());
+				insert<ComponentTicks<TType>>(entities.begin(), entities.end(), {m_ChangeTick, m_ChangeTick});
+			}
+		}
+
+		std::vector<GroupSignature> m_Groups{};
+		std::vector<void (*)(EntityManager&, Entity)> m_LaneRemovers{};
+		std::vector<void (*)(EntityManager&)> m_LaneShrinkers{};
+		std::vector<void (*)(EntityManager&, Entity, Entity)> m_LaneCopiers{};
+		std::size_t m_CompactCursor{};
+		std::vector<std::unique_ptr<EntityObserver>> m_Observers{};
+		std::uint64_t m_ChangeTick{1};
+	};
+
+	/// @brief Template of components copied to entities created from it.
+	class Prefab
+	{
+	public:
+		/// @brief Add a component, replacing one of the same type.
+		/// @tparam TType Component type.
+		/// @tparam TArgs Component constructor argument types.
+		/// @param args Component constructor arguments.
+		/// @return A reference to the current prefab.
+		template <std::copy_constructible TType, typename... TArgs>
+		auto Add(TArgs&&... args) -> Prefab&
+		{
+			Remove<TType>();
+
+			std::shared_ptr<const TType> value{};
+			if constexpr (std::is_aggregate_v<TType>)
+				value = std::make_shared<const TType>(TType{std::forward<TArgs>(args)...});
+			else
+				value = std::make_shared<const TType>(std::forward<TArgs>(args)...);
+
+			m_Components.push_back(Component{
+				.Type = entt::type_hash<TType>::value(),
+				.Value = std::move(value),
+				.Create = &CreateComponents<TType>,
+			});
+
+			return *this;
+		}
+
+		/// @brief Remove a component.
+		/// @tparam TType Component type.
+		/// @return @c true if the component was removed, @c false otherwise.
+		template <typename TType>
+		auto Remove() -> bool
+		{
+			return std::erase_if(m_Components, [](const Component& component) {
+				return component.Type == entt::type_hash<TType>::value();
+			}) > 0;
+		}
+
+		/// @brief Check if the prefab has a component.
+		/// @tparam TType Component type.
+		/// @return @c true if the prefab has the component, @c false otherwise.
+		template <typename TType>
+		[[nodiscard]] auto Has() const -> bool
+		{
+			return std::ranges::find(m_Components, entt::type_hash<TType>::value(), &Component::Type) !=
+				m_Components.end();
+		}
+
+		/// @brief Get the number of components.
+		/// @return Number of components.
+		[[nodiscard]] auto Size() const -> std::size_t;
+
+	private:
+		friend class EntityManager;
+
+		struct Component
+		{
+			entt::id_type Type{};
+			std::shared_ptr<const void> Value{};
+			void (*Create)(EntityManager&, std::span<const Entity>, const void*){};
+		};
+
+		template <typename TType>
+		static auto CreateComponents(EntityManager& entities, std::span<const Entity> created, const void* value)
+			-> void
+		{
+			entities.CreateComponents<TType>(created, *static_cast<const TType*>(value));
+		}
+
+		std::vector<Component> m_Components{};
 	};
 
 	/// @brief A view on entities with certain components.
@@ -225,12 +1263,20 @@ namespace Star
 		/// @brief Component list of types excluded in the view.
 		using Excludes = ComponentList<TExcludes...>;
 
+		/// @brief Underlying view handle type.
+		using Handle = entt::basic_view<
+			entt::get_t<EntityManager::Storage<typename ViewComponent<TIncludes>::Type>...>,
+			entt::exclude_t<EntityManager::Storage<TExcludes>...>>;
+
+		/// @brief Construct an invalid entity view.
+		EntityView() = default;
+
 		/// @brief Construct a new entity view.
-		/// @tparam TArgs Constructor argument types.
-		/// @param args Constructor arguments.
-		template <typename... TArgs>
-		EntityView(TArgs&&... args) :
-			m_View{std::forward<TArgs>(args)...}
+		/// @param view Underlying view handle.
+		/// @param lastRun Change tick included change filters compare against.
+		EntityView(Handle view, std::uint64_t lastRun = 0) : // NOLINT(google-explicit-constructor)
+			m_View{view},
+			m_LastRun{lastRun}
 		{
 		}
 
@@ -241,18 +1287,92 @@ namespace Star
 			return static_cast<bool>(m_View);
 		}
 
+		/// @brief Iterator skipping entities that do not pass the change filters of a view.
+		class Iterator
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag; // NOLINT(readability-identifier-naming)
+			using value_type = Entity; // NOLINT(readability-identifier-naming)
+			using difference_type = std::ptrdiff_t; // NOLINT(readability-identifier-naming)
+			using pointer = const Entity*; // NOLINT(readability-identifier-naming)
+			using reference = Entity; // NOLINT(readability-identifier-naming)
+
+			/// @brief Construct an end iterator.
+			Iterator() = default;
+
+			/// @brief Construct an iterator.
+			/// @param view View to iterate.
+			/// @param current Underlying iterator to start at.
+			Iterator(const EntityView* view, decltype(std::declval<const Handle&>().begin()) current) :
+				m_Owner{view},
+				m_Current{current}
+			{
+				Skip();
+			}
+
+			/// @brief Get the current entity.
+			/// @return Entity handle.
+			[[nodiscard]] auto operator*() const -> Entity
+			{
+				return *m_Current;
+			}
+
+			/// @brief Advance to the next entity.
+			/// @return Reference to the current iterator.
+			auto operator++() -> Iterator&
+			{
+				++m_Current;
+				Skip();
+				return *this;
+			}
+
+			/// @brief Advance to the next entity.
+			/// @return Iterator before advancing.
+			auto operator++(int) -> Iterator
+			{
+				auto previous = *this;
+				++*this;
+				return previous;
+			}
+
+			/// @brief Equality operator.
+			/// @param lhs Left comparison instance.
+			/// @param rhs Right comparison instance.
+			/// @return @c true if both iterators point to the same entity, @c false otherwise.
+			[[nodiscard]] friend auto operator==(const Iterator& lhs, const Iterator& rhs) -> bool
+			{
+				return lhs.m_Current == rhs.m_Current;
+			}
+
+		private:
+			auto Skip() -> void
+			{
+				while (m_Current != m_Owner->m_View.end() && !m_Owner->Passes(*m_Current))
+					++m_Current;
+			}
+
+			const EntityView* m_Owner{};
+			decltype(std::declval<const Handle&>().begin()) m_Current{};
+		};
+
 		/// @brief Get an iterator for the start of the view.
 		/// @return Iterator to the first entity.
 		[[nodiscard]] auto begin() const // NOLINT(readability-identifier-naming)
 		{
-			return m_View.begin();
+			if constexpr (TickFiltered())
+				return Iterator{this, m_View.begin()};
+			else
+				return m_View.begin();
 		}
 
 		/// @brief Get an iterator for the end of the view.
 		/// @return Iterator past the last entity.
 		[[nodiscard]] auto end() const // NOLINT(readability-identifier-naming)
 		{
-			return m_View.end();
+			if constexpr (TickFiltered())
+				return Iterator{this, m_View.end()};
+			else
+				return m_View.end();
 		}
 
 		/// @brief Get a component on an entity.
@@ -267,16 +1387,321 @@ namespace Star
 
 		/// @brief Check if an entity is contained in the view.
 		/// @param entity Valid entity handle.
+		/// @return @c true if the entity is contained and passes the change filters, @c false otherwise.
+		[[nodiscard]] auto Contains(Entity entity) const -> bool
+		{
+			return m_View.contains(entity) && Passes(entity);
+		}
+
+		/// @brief Default number of entities per chunk, matching the page size of entity storages.
+		static constexpr std::size_t DefaultChunkSize = 1024;
+
+		/// @brief Invoke a function for chunks of candidate entities on worker threads.
+		/// @details Chunks are consecutive ranges of the smallest included storage, rounded to whole cache lines.
+		/// Unless the view includes exactly one component and neither excludes components nor filters changes,
+		/// candidates have to be checked with @c Contains.
+		/// @tparam TFunction Function type.
+		/// @param jobs Job system to execute on.
+		/// @param function Function invoked with each chunk of candidate entities.
+		/// @param chunkSize Number of entities per chunk.
+		template <std::invocable<std::span<const Entity>> TFunction>
+		auto ParallelChunks(JobSystem& jobs, TFunction function, std::size_t chunkSize = DefaultChunkSize) const
+			-> void
+		{
+			// The leading storage is missing while the view is invalid or one of its storages does not exist yet.
+			const auto* handle = m_View ? m_View.handle() : nullptr;
+			if (handle == nullptr)
+				return;
+
+			static constexpr auto lineSize = std::max<std::size_t>(CacheLineSize / sizeof(Entity), 1);
+			chunkSize = (std::max<std::size_t>(chunkSize, 1) + lineSize - 1) / lineSize * lineSize;
+
+			auto candidates = std::span<const Entity>{handle->data(), handle->size()};
+
+			jobs.ParallelRange(candidates.size(), chunkSize, [&](std::size_t begin, std::size_t end) {
+				function(candidates.subspan(begin, end - begin));
+			});
+		}
+
+		/// @brief Invoke a function for every entity in the view on worker threads.
+		/// @tparam TFunction Function type.
+		/// @param jobs Job system to execute on.
+		/// @param function Function invoked with each entity followed by its non-empty included components, skipping
+		/// change filters.
+		/// @param chunkSize Number of entities per chunk.
+		template <typename TFunction>
+		auto ParallelEach(JobSystem& jobs, TFunction function, std::size_t chunkSize = DefaultChunkSize) const
+			-> void
+		{
+			ParallelChunks(
+				jobs,
+				[&](std::span<const Entity> chunk) {
+					for (auto entity : chunk)
+					{
+						if (Filtered() && !Contains(entity))
+							continue;
+
+						std::apply(function, std::tuple_cat(std::tuple{entity}, Components(entity)));
+					}
+				},
+				chunkSize
+			);
+		}
+
+		/// @brief Reduce all entities in the view to a single value on worker threads.
+		/// @details Every thread accumulates into its own cache line aligned accumulator starting at @p identity,
+		/// which are combined on the calling thread afterwards.
+		/// @tparam TValue Accumulated value type.
+		/// @tparam TFunction Accumulate function type.
+		/// @tparam TCombine Combine function type.
+		/// @param jobs Job system to execute on.
+		/// @param identity Initial value of every accumulator, neutral with respect to @p combine.
+		/// @param function Function invoked with an accumulator, each entity and its non-empty included components,
+		/// skipping change filters.
+		/// @param combine Function merging the second accumulator into the first.
+		/// @param chunkSize Number of entities per chunk.
+		/// @return The combined value of all accumulators.
+		template <typename TValue, typename TFunction, std::invocable<TValue&, const TValue&> TCombine>
+		[[nodiscard]] auto ParallelReduce(
+			JobSystem& jobs,
+			const TValue& identity,
+			TFunction function,
+			TCombine combine,
+			std::size_t chunkSize = DefaultChunkSize
+		) const -> TValue
+		{
+			struct alignas(CacheLineSize) Accumulator
+			{
+				TValue Value{};
+			};
+
+			std::vector<Accumulator> accumulators(jobs.ThreadCount(), Accumulator{identity});
+
+			ParallelChunks(
+				jobs,
+				[&](std::span<const Entity> chunk) {
+					auto& value = accumulators[jobs.ThreadIndex()].Value;
+					for (auto entity : chunk)
+					{
+						if (Filtered() && !Contains(entity))
+							continue;
+
+						std::apply(function, std::tuple_cat(std::tie(value), std::tuple{entity}, Components(entity)));
+					}
+				},
+				chunkSize
+			);
+
+			auto result = identity;
+			for (const auto& accumulator : accumulators)
+				combine(result, accumulator.Value);
+
+			return result;
+		}
+
+	private:
+		[[nodiscard]] static constexpr auto TickFiltered() -> bool
+		{
+			return (ViewComponent<TIncludes>::Filtered() || ...);
+		}
+
+		[[nodiscard]] static constexpr auto Filtered() -> bool
+		{
+			return sizeof...(TIncludes) > 1 || sizeof...(TExcludes) > 0 || TickFiltered();
+		}
+
+		[[nodiscard]] auto Passes(Entity entity) const -> bool
+		{
+			return (PassesFilter<TIncludes>(entity) && ...);
+		}
+
+		template <typename TType>
+		[[nodiscard]] auto PassesFilter(Entity entity) const -> bool
+		{
+			if constexpr (ViewComponent<TType>::Filtered())
+			{
+				using Ticks = typename ViewComponent<TType>::Type;
+				return ViewComponent<TType>::Passes(m_View.template get<Ticks>(entity), m_LastRun);
+			}
+			else
+				return true;
+		}
+
+		[[nodiscard]] auto Components(Entity entity) const
+		{
+			if constexpr (TickFiltered())
+				return std::tuple_cat(ComponentTuple<TIncludes>(entity)...);
+			else
+				return m_View.get(entity);
+		}
+
+		template <typename TType>
+		[[nodiscard]] auto ComponentTuple(Entity entity) const
+		{
+			if constexpr (ViewComponent<TType>::Filtered() || std::is_empty_v<TType>)
+				return std::tuple{};
+			else
+				return std::forward_as_tuple(m_View.template get<TType>(entity));
+		}
+
+		Handle m_View{};
+		std::uint64_t m_LastRun{};
+	};
+
+	/// @brief A group on entities with certain components, owning the storages of some of them.
+	/// @details Entities of the group and their owned components are packed at the front of the owned storages, so
+	/// that owned components are accessed by index while iterating, without looking up the entity.
+	/// @tparam TOwned Component types owned by the group.
+	/// @tparam TGets Component types included in the group, but not owned.
+	/// @tparam TExcludes Component types to exclude from the group.
+	template <typename... TOwned, typename... TGets, typename... TExcludes>
+	class EntityGroup<ComponentList<TOwned...>, ComponentList<TGets...>, ComponentList<TExcludes...>>
+	{
+	public:
+		/// @brief Component list of types owned by the group.
+		using Owned = ComponentList<TOwned...>;
+
+		/// @brief Component list of types included in the group, but not owned.
+		using Gets = ComponentList<TGets...>;
+
+		/// @brief Component list of types excluded from the group.
+		using Excludes = ComponentList<TExcludes...>;
+
+		/// @brief Construct a new entity group.
+		/// @param group Underlying group handle.
+		/// @param storages Storages of the owned component types.
+		EntityGroup(
+			entt::basic_group<
+				entt::owned_t<EntityManager::Storage<TOwned>...>,
+				entt::get_t<EntityManager::Storage<TGets>...>,
+				entt::exclude_t<EntityManager::Storage<TExcludes>...>> group,
+			EntityManager::Storage<TOwned>*... storages
+		) :
+			m_Group{group},
+			m_Storages{storages...}
+		{
+		}
+
+		/// @brief Get the number of entities in the group.
+		/// @return Number of entities.
+		[[nodiscard]] auto Size() const -> std::size_t
+		{
+			return m_Group.size();
+		}
+
+		/// @brief Get the entities in the group.
+		/// @details Entities are ordered by their index in the group.
+		/// @return Entities in the group.
+		[[nodiscard]] auto Entities() const -> std::span<const Entity>
+		{
+			return {std::get<0>(m_Storages)->data(), Size()};
+		}
+
+		/// @brief Get an iterator for the start of the group.
+		/// @return Iterator to the first entity.
+		[[nodiscard]] auto begin() const // NOLINT(readability-identifier-naming)
+		{
+			return Entities().begin();
+		}
+
+		/// @brief Get an iterator for the end of the group.
+		/// @return Iterator past the last entity.
+		[[nodiscard]] auto end() const // NOLINT(readability-identifier-naming)
+		{
+			return Entities().end();
+		}
+
+		/// @brief Get an owned component by the index of its entity in the group.
+		/// @tparam TType Owned component type.
+		/// @param index Index smaller than the size of the group.
+		/// @return A reference to the component.
+		template <typename TType>
+		[[nodiscard]] auto At(std::size_t index) const -> TType&
+		{
+			return std::get<EntityManager::Storage<TType>*>(m_Storages)->rbegin()[static_cast<std::ptrdiff_t>(index)];
+		}
+
+		/// @brief Get a component on an entity.
+		/// @tparam TType Component type.
+		/// @param entity Valid entity handle.
+		/// @return A reference to the component.
+		template <typename TType>
+		[[nodiscard]] auto Get(Entity entity) const -> decltype(auto)
+		{
+			return m_Group.template get<TType>(entity);
+		}
+
+		/// @brief Check if an entity is contained in the group.
+		/// @param entity Valid entity handle.
 		/// @return @c true if the entity is contained, @c false otherwise.
 		[[nodiscard]] auto Contains(Entity entity) const -> bool
 		{
-			return m_View.contains(entity);
+			return m_Group.contains(entity);
+		}
+
+		/// @brief Invoke a function for every entity in the group.
+		/// @tparam TFunction Function type.
+		/// @param function Function invoked with each entity followed by its non-empty owned and included components.
+		template <typename TFunction>
+		auto Each(TFunction function) const -> void
+		{
+			auto entities = Entities();
+			for (std::size_t index = 0; index < entities.size(); ++index)
+				std::apply(function, Components(index, entities[index]));
+		}
+
+		/// @brief Default number of entities per chunk, matching the page size of entity storages.
+		static constexpr std::size_t DefaultChunkSize = 1024;
+
+		/// @brief Invoke a function for every entity in the group on worker threads.
+		/// @details Chunks are consecutive index ranges of the group, rounded to whole cache lines.
+		/// @tparam TFunction Function type.
+		/// @param jobs Job system to execute on.
+		/// @param function Function invoked with each entity followed by its non-empty owned and included components.
+		/// @param chunkSize Number of entities per chunk.
+		template <typename TFunction>
+		auto ParallelEach(JobSystem& jobs, TFunction function, std::size_t chunkSize = DefaultChunkSize) const
+			-> void
+		{
+			static constexpr auto lineSize = std::max<std::size_t>(CacheLineSize / sizeof(Entity), 1);
+			chunkSize = (std::max<std::size_t>(chunkSize, 1) + lineSize - 1) / lineSize * lineSize;
+
+			auto entities = Entities();
+			jobs.ParallelRange(entities.size(), chunkSize, [&](std::size_t begin, std::size_t end) {
+				for (auto index = begin; index < end; ++index)
+					std::apply(function, Components(index, entities[index]));
+			});
 		}
 
 	private:
-		entt::basic_view<
-			entt::get_t<EntityManager::Storage<TIncludes>...>,
+		template <typename TType>
+		[[nodiscard]] auto OwnedTuple(std::size_t index) const
+		{
+			if constexpr (std::is_empty_v<TType>)
+				return std::tuple{};
+			else
+				return std::forward_as_tuple(At<TType>(index));
+		}
+
+		template <typename TType>
+		[[nodiscard]] auto GetTuple(Entity entity) const
+		{
+			if constexpr (std::is_empty_v<TType>)
+				return std::tuple{};
+			else
+				return std::forward_as_tuple(Get<TType>(entity));
+		}
+
+		[[nodiscard]] auto Components(std::size_t index, Entity entity) const
+		{
+			return std::tuple_cat(std::tuple{entity}, OwnedTuple<TOwned>(index)..., GetTuple<TGets>(entity)...);
+		}
+
+		entt::basic_group<
+			entt::owned_t<EntityManager::Storage<TOwned>...>,
+			entt::get_t<EntityManager::Storage<TGets>...>,
 			entt::exclude_t<EntityManager::Storage<TExcludes>...>>
-			m_View{};
+			m_Group{};
+		std::tuple<EntityManager::Storage<TOwned>*...> m_Storages{};
 	};
 } //namespace Star
@@ -0,0 +1,137 @@
+#include "Input.hpp"
+
+namespace Star
+{
+	static_assert(static_cast<std::size_t>(Button::Count) <= 8, "Mouse buttons have to fit into a byte mask");
+
+	auto InputState::Held(Key key) const -> bool
+	{
+		return m_Keys.test(static_cast<std::size_t>(key));
+	}
+
+	auto InputState::Pressed(Key key) const -> bool
+	{
+		auto index = static_cast<std::size_t>(key);
+		return (m_Keys.test(index) && !m_PreviousKeys.test(index)) || m_TappedKeys.test(index);
+	}
+
+	auto InputState::Released(Key key) const -> bool
+	{
+		auto index = static_cast<std::size_t>(key);
+		return (!m_Keys.test(index) && m_PreviousKeys.test(index)) || m_TappedKeys.test(index);
+	}
+
+	auto InputState::Held(Button button) const -> bool
+	{
+		return (m_Buttons & Bit(button)) != 0;
+	}
+
+	auto InputState::Pressed(Button button) const -> bool
+	{
+		return ((((m_Buttons ^ m_PreviousButtons) & m_Buttons) | m_TappedButtons) & Bit(button)) != 0;
+	}
+
+	auto InputState::Released(Button button) const -> bool
+	{
+		return ((((m_Buttons ^ m_PreviousButtons) & m_PreviousButtons) | m_TappedButtons) & Bit(button)) != 0;
+	}
+
+	auto InputState::HeldKeys() const -> const KeySet&
+	{
+		return m_Keys;
+	}
+
+	auto InputState::PressedKeys() const -> KeySet
+	{
+		return ((m_Keys ^ m_PreviousKeys) & m_Keys) | m_TappedKeys;
+	}
+
+	auto InputState::ReleasedKeys() const -> KeySet
+	{
+		return ((m_Keys ^ m_PreviousKeys) & m_PreviousKeys) | m_TappedKeys;
+	}
+
+	auto InputState::MousePosition() const -> glm::i32vec2
+	{
+		return m_Position;
+	}
+
+	auto InputState::MouseMovement() const -> glm::i32vec2
+	{
+		return m_Movement;
+	}
+
+	auto InputState::Scroll() const -> glm::vec2
+	{
+		return m_Scroll;
+	}
+
+	auto InputState::Apply(const KeyboardEventArgs& event) -> void
+	{
+		auto index = static_cast<std::size_t>(event.Key);
+		if (index >= m_Keys.size())
+			return;
+
+		// A release of a key pressed during the same update would otherwise leave no edge behind.
+		if (!event.Pressed && m_Keys.test(index) && !m_PreviousKeys.test(index))
+			m_TappedKeys.set(index);
+
+		m_Keys.set(index, event.Pressed);
+	}
+
+	auto InputState::Apply(const MouseButtonEventArgs& event) -> void
+	{
+		if (static_cast<std::size_t>(event.Button) >= static_cast<std::size_t>(Button::Count))
+			return;
+
+		auto bit = Bit(event.Button);
+		if (!event.Pressed && (m_Buttons & bit) != 0 && (m_PreviousButtons & bit) == 0)
+			m_TappedButtons |= bit;
+
+		m_Buttons = event.Pressed ? m_Buttons | bit : m_Buttons & ~bit;
+		m_Position = event.Position;
+	}
+
+	auto InputState::Apply(const MouseMotionEventArgs& event) -> void
+	{
+		m_Position = event.Position;
+		m_Movement += event.Movement;
+	}
+
+	auto InputState::Apply(const MouseScrollEventArgs& event) -> void
+	{
+		m_Scroll += event.Scroll;
+	}
+
+	auto InputState::Apply(const WindowEventBatch& events) -> void
+	{
+		for (const auto& event : events.Events<KeyboardEventArgs>())
+			Apply(event);
+
+		for (const auto& event : events.Events<MouseButtonEventArgs>())
+			Apply(event);
+
+		for (const auto& event : events.Events<MouseMotionEventArgs>())
+			Apply(event);
+
+		for (const auto& event : events.Events<MouseScrollEventArgs>())
+			Apply(event);
+	}
+
+	auto InputState::Advance() -> void
+	{
+		m_PreviousKeys = m_Keys;
+		m_TappedKeys.reset();
+
+		m_PreviousButtons = m_Buttons;
+		m_TappedButtons = 0;
+
+		m_Movement = {};
+		m_Scroll = {};
+	}
+
+	auto InputState::Bit(Button button) -> std::uint8_t
+	{
+		return static_cast<std::uint8_t>(1U << static_cast<unsigned>(button));
+	}
+} //namespace Star
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "Starlight/Platform/Window.hpp"
+
+#include <glm/vec2.hpp>
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+
+namespace Star
+{
+	/// @brief Keyboard and mouse state of the current update, available as an entity manager singleton.
+	/// @details Previous and current key states are kept as bitsets, so press and release edges of all keys are
+	/// derived with a few word-wide XOR and AND operations. Presses shorter than an update are reported as both
+	/// pressed and released, without the key being held.
+	class InputState
+	{
+	public:
+		/// @brief Bitset with a bit per keyboard scancode.
+		using KeySet = std::bitset<static_cast<std::size_t>(Key::Count)>;
+
+		/// @brief Check if a key is held down.
+		/// @param key Keyboard scancode.
+		/// @return @c true if held, @c false otherwise.
+		[[nodiscard]] auto Held(Key key) const -> bool;
+
+		/// @brief Check if a key has been pressed during the current update.
+		/// @param key Keyboard scancode.
+		/// @return @c true if pressed, @c false otherwise.
+		[[nodiscard]] auto Pressed(Key key) const -> bool;
+
+		/// @brief Check if a key has been released during the current update.
+		/// @param key Keyboard scancode.
+		/// @return @c true if released, @c false otherwise.
+		[[nodiscard]] auto Released(Key key) const -> bool;
+
+		/// @brief Check if a mouse button is held down.
+		/// @param button Mouse button.
+		/// @return @c true if held, @c false otherwise.
+		[[nodiscard]] auto Held(Button button) const -> bool;
+
+		/// @brief Check if a mouse button has been pressed during the current update.
+		/// @param button Mouse button.
+		/// @return @c true if pressed, @c false otherwise.
+		[[nodiscard]] auto Pressed(Button button) const -> bool;
+
+		/// @brief Check if a mouse button has been released during the current update.
+		/// @param button Mouse button.
+		/// @return @c true if released, @c false otherwise.
+		[[nodiscard]] auto Released(Button button) const -> bool;
+
+		/// @brief Get all keys held down.
+		/// @return Bitset indexed by scancode.
+		[[nodiscard]] auto HeldKeys() const -> const KeySet&;
+
+		/// @brief Get all keys pressed during the current update.
+		/// @return Bitset indexed by scancode.
+		[[nodiscard]] auto PressedKeys() const -> KeySet;
+
+		/// @brief Get all keys released during the current update.
+		/// @return Bitset indexed by scancode.
+		[[nodiscard]] auto ReleasedKeys() const -> KeySet;
+
+		/// @brief Get the latest mouse position.
+		/// @return Position relative to the window with the mouse focus.
+		[[nodiscard]] auto MousePosition() const -> glm::i32vec2;
+
+		/// @brief Get the mouse movement during the current update.
+		/// @return Accumulated movement.
+		[[nodiscard]] auto MouseMovement() const -> glm::i32vec2;
+
+		/// @brief Get the mouse wheel movement during the current update.
+		/// @return Accumulated scroll.
+		[[nodiscard]] auto Scroll() const -> glm::vec2;
+
+		/// @brief Apply a key update.
+		/// @param event Event arguments.
+		auto Apply(const KeyboardEventArgs& event) -> void;
+
+		/// @brief Apply a mouse button update.
+		/// @param event Event arguments.
+		auto Apply(const MouseButtonEventArgs& event) -> void;
+
+		/// @brief Apply a mouse movement.
+		/// @param event Event arguments.
+		auto Apply(const MouseMotionEventArgs& event) -> void;
+
+		/// @brief Apply a mouse wheel movement.
+		/// @param event Event arguments.
+		auto Apply(const MouseScrollEventArgs& event) -> void;
+
+		/// @brief Apply all input events of a batch.
+		/// @param events Batched window events.
+		auto Apply(const WindowEventBatch& events) -> void;
+
+		/// @brief Start the next update, turning the current state into the previous one.
+		/// @details Called by worlds at the end of every update.
+		auto Advance() -> void;
+
+	private:
+		[[nodiscard]] static auto Bit(Button button) -> std::uint8_t;
+
+		KeySet m_Keys{};
+		KeySet m_PreviousKeys{};
+		KeySet m_TappedKeys{};
+
+		std::uint8_t m_Buttons{};
+		std::uint8_t m_PreviousButtons{};
+		std::uint8_t m_TappedButtons{};
+
+		glm::i32vec2 m_Position{};
+		glm::i32vec2 m_Movement{};
+		glm::vec2 m_Scroll{};
+	};
+} //namespace Star
@@ -0,0 +1,475 @@
+#include "Job.hpp"
+
+#include <algorithm>
+#include <array>
+#include <exception>
+
+namespace
+{
+	using namespace Star;
+
+	struct ThreadSlot
+	{
+		const JobSystem* Owner{};
+		std::size_t Index{};
+	};
+
+	thread_local ThreadSlot t_Slot{};
+	thread_local bool t_RunningMainJobs{};
+
+	constexpr std::int64_t DequeCapacity = 4096;
+	constexpr int SpinCount = 64;
+} //namespace
+
+namespace Star
+{
+	/// Fixed capacity Chase-Lev deque: the owner pushes and pops at the bottom, thieves steal from the top.
+	struct JobSystem::Deque
+	{
+		alignas(CacheLineSize) std::atomic<std::int64_t> Top{};
+		alignas(CacheLineSize) std::atomic<std::int64_t> Bottom{};
+		alignas(CacheLineSize) std::array<std::atomic<Job*>, DequeCapacity> Buffer{};
+
+		[[nodiscard]] auto Push(Job* job) -> bool
+		{
+			auto bottom = Bottom.load(std::memory_order_relaxed);
+			auto top = Top.load(std::memory_order_acquire);
+
+			if (bottom - top >= DequeCapacity)
+				return false;
+
+			Buffer[bottom % DequeCapacity].store(job, std::memory_order_relaxed);
+			Bottom.store(bottom + 1, std::memory_order_release);
+			return true;
+		}
+
+		[[nodiscard]] auto Pop() -> Job*
+		{
+			auto bottom = Bottom.load(std::memory_order_relaxed) - 1;
+			Bottom.store(bottom, std::memory_order_seq_cst);
+			auto top = Top.load(std::memory_order_seq_cst);
+
+			if (top > bottom)
+			{
+				Bottom.store(bottom + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			auto* job = Buffer[bottom % DequeCapacity].load(std::memory_order_relaxed);
+			if (top == bottom)
+			{
+				if (!Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+					job = nullptr;
+
+				Bottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+
+			return job;
+		}
+
+		[[nodiscard]] auto Steal() -> Job*
+		{
+			auto top = Top.load(std::memory_order_seq_cst);
+			auto bottom = Bottom.load(std::memory_order_seq_cst);
+
+			if (top >= bottom)
+				return nullptr;
+
+			auto* job = Buffer[top % DequeCapacity].load(std::memory_order_relaxed);
+			if (!Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				return nullptr;
+
+			return job;
+		}
+	};
+
+	struct alignas(CacheLineSize) JobSystem::Worker
+	{
+		Deque Jobs{};
+		alignas(CacheLineSize) std::atomic<std::uint64_t> BusyTime{};
+		std::atomic<std::uint64_t> Executed{};
+		std::atomic<std::uint64_t> Stolen{};
+	};
+
+	struct JobSystem::Range
+	{
+		RangeFunction Function{};
+		void* Data{};
+		std::size_t Count{};
+		std::size_t Grain{};
+		alignas(CacheLineSize) std::atomic<std::size_t> Next{};
+		std::atomic_flag Failed{};
+		std::exception_ptr Exception{};
+	};
+
+	auto JobCounter::Done() const -> bool
+	{
+		// Completing threads hold the lock while decrementing, so the counter is only released once they are done.
+		return m_Pending.load(std::memory_order_acquire) == 0 && !m_Locked.test(std::memory_order_acquire);
+	}
+
+	auto JobCounter::Lock() -> void
+	{
+		while (m_Locked.test_and_set(std::memory_order_acquire))
+			std::this_thread::yield();
+	}
+
+	auto JobCounter::Unlock() -> void
+	{
+		m_Locked.clear(std::memory_order_release);
+	}
+
+	Job::Job(void (*function)(void*), void* data) :
+		m_Function{function},
+		m_Data{data}
+	{
+	}
+
+	auto Job::operator()() const -> void
+	{
+		m_Function(m_Data);
+	}
+
+	JobSystem::JobSystem(std::size_t workerCount) :
+		m_StatsTime{std::chrono::steady_clock::now()}
+	{
+		Bind();
+
+		m_Workers.reserve(workerCount + 1);
+		for (std::size_t i = 0; i <= workerCount; ++i)
+			m_Workers.push_back(std::make_unique<Worker>());
+
+		m_Threads.reserve(workerCount);
+		for (std::size_t i = 1; i <= workerCount; ++i)
+			m_Threads.emplace_back([this, i] { WorkerMain(i); });
+	}
+
+	JobSystem::~JobSystem()
+	{
+		m_Stopping.store(true, std::memory_order_release);
+		m_Signal.fetch_add(1, std::memory_order_seq_cst);
+		m_Signal.notify_all();
+
+		for (auto& thread : m_Threads)
+			thread.join();
+
+		if (t_Slot.Owner == this)
+			t_Slot = ThreadSlot{};
+	}
+
+	auto JobSystem::Bind() -> void
+	{
+		m_Owner.store(std::this_thread::get_id(), std::memory_order_release);
+		t_Slot = ThreadSlot{
+			.Owner = this,
+			.Index = 0,
+		};
+	}
+
+	auto JobSystem::DefaultWorkerCount() -> std::size_t
+	{
+		return std::max(std::thread::hardware_concurrency(), 1U) - 1;
+	}
+
+	auto JobSystem::WorkerCount() const -> std::size_t
+	{
+		return m_Threads.size();
+	}
+
+	auto JobSystem::ThreadCount() const -> std::size_t
+	{
+		return m_Workers.size();
+	}
+
+	auto JobSystem::ThreadIndex() const -> std::size_t
+	{
+		return Participates() ? t_Slot.Index : 0;
+	}
+
+	auto JobSystem::Participates() const -> bool
+	{
+		// Slot 0 stays set on a previous owner after rebinding, so it is confirmed against the owning thread.
+		return t_Slot.Owner == this &&
+			(t_Slot.Index != 0 || m_Owner.load(std::memory_order_acquire) == std::this_thread::get_id());
+	}
+
+	auto JobSystem::Schedule(Job& job, JobCounter* counter, JobCounter* dependency) -> void
+	{
+		job.m_Counter = counter;
+		if (counter != nullptr)
+			counter->m_Pending.fetch_add(1, std::memory_order_acq_rel);
+
+		if (dependency != nullptr)
+		{
+			dependency->Lock();
+			if (dependency->m_Pending.load(std::memory_order_acquire) != 0)
+			{
+				job.m_Next = std::exchange(dependency->m_Waiting, &job);
+				dependency->Unlock();
+				return;
+			}
+
+			dependency->Unlock();
+		}
+
+		Push(job);
+	}
+
+	auto JobSystem::Wait(JobCounter& counter) -> void
+	{
+		auto participates = Participates();
+		auto index = ThreadIndex();
+
+		while (!counter.Done())
+		{
+			if (participates)
+			{
+				if (index == 0 && RunMainJobs() > 0)
+					continue;
+
+				if (auto* job = Find(index))
+				{
+					Execute(*job, index);
+					continue;
+				}
+			}
+
+			std::this_thread::yield();
+		}
+	}
+
+	auto JobSystem::ScheduleMain(std::function<void()> function, JobCounter* counter) -> void
+	{
+		if (counter != nullptr)
+			counter->m_Pending.fetch_add(1, std::memory_order_acq_rel);
+
+		std::scoped_lock lock{m_MainMutex};
+		m_MainJobs.emplace_back(std::move(function), counter);
+	}
+
+	auto JobSystem::RunMainJobs() -> std::size_t
+	{
+		// Main thread jobs waiting on other jobs must not recurse into the list currently being executed.
+		if (t_RunningMainJobs)
+			return 0;
+
+		{
+			std::scoped_lock lock{m_MainMutex};
+			if (m_MainJobs.empty())
+				return 0;
+
+			m_MainJobsRunning.swap(m_MainJobs);
+		}
+
+		t_RunningMainJobs = true;
+
+		for (auto& [function, counter] : m_MainJobsRunning)
+		{
+			function();
+
+			if (counter != nullptr)
+				Complete(*counter);
+		}
+
+		t_RunningMainJobs = false;
+
+		auto count = m_MainJobsRunning.size();
+		m_MainJobsRunning.clear();
+		return count;
+	}
+
+	auto JobSystem::CollectStats() -> std::vector<WorkerStats>
+	{
+		auto now = std::chrono::steady_clock::now();
+		auto wall = std::chrono::duration_cast<std::chrono::nanoseconds>(now - std::exchange(m_StatsTime, now));
+		auto wallTime = static_cast<double>(std::max<std::int64_t>(wall.count(), 1));
+
+		std::vector<WorkerStats> stats{};
+		stats.reserve(m_Workers.size());
+
+		for (const auto& worker : m_Workers)
+		{
+			auto busyTime = static_cast<double>(worker->BusyTime.exchange(0, std::memory_order_relaxed));
+
+			stats.push_back(WorkerStats{
+				.Utilization = std::min(busyTime / wallTime, 1.0),
+				.Executed = worker->Executed.exchange(0, std::memory_order_relaxed),
+				.Stolen = worker->Stolen.exchange(0, std::memory_order_relaxed),
+			});
+		}
+
+		return stats;
+	}
+
+	auto JobSystem::Run(std::size_t count, std::size_t grain, RangeFunction function, void* data) -> void
+	{
+		if (count == 0)
+			return;
+
+		grain = std::max<std::size_t>(grain, 1);
+
+		auto chunks = (count + grain - 1) / grain;
+		if (chunks == 1 || m_Threads.empty())
+		{
+			function(data, 0, count);
+			return;
+		}
+
+		Range range{
+			.Function = function,
+			.Data = data,
+			.Count = count,
+			.Grain = grain,
+		};
+
+		auto body = [&range] {
+			for (auto begin = range.Next.fetch_add(range.Grain, std::memory_order_relaxed); begin < range.Count;
+				 begin = range.Next.fetch_add(range.Grain, std::memory_order_relaxed))
+			{
+				try
+				{
+					range.Function(range.Data, begin, std::min(begin + range.Grain, range.Count));
+				}
+				catch (...)
+				{
+					if (!range.Failed.test_and_set(std::memory_order_relaxed))
+						range.Exception = std::current_exception();
+				}
+			}
+		};
+
+		auto participates = Participates();
+		auto jobCount = std::min({chunks, ThreadCount(), MaxRangeJobs});
+
+		std::array<Job, MaxRangeJobs> jobs{};
+		JobCounter counter{};
+
+		for (std::size_t i = participates ? 1 : 0; i < jobCount; ++i)
+		{
+			jobs.at(i) = Job{body};
+			Schedule(jobs.at(i), &counter);
+		}
+
+		if (participates)
+			body();
+
+		Wait(counter);
+
+		if (range.Exception)
+			std::rethrow_exception(range.Exception);
+	}
+
+	auto JobSystem::Push(Job& job) -> void
+	{
+		if (Participates())
+		{
+			if (!m_Workers[t_Slot.Index]->Jobs.Push(&job))
+			{
+				Execute(job, t_Slot.Index);
+				return;
+			}
+		}
+		else
+		{
+			std::scoped_lock lock{m_InjectedMutex};
+			m_Injected.push_back(&job);
+			m_InjectedCount.fetch_add(1, std::memory_order_release);
+		}
+
+		m_Signal.fetch_add(1, std::memory_order_seq_cst);
+		if (m_Sleeping.load(std::memory_order_seq_cst) > 0)
+			m_Signal.notify_one();
+	}
+
+	auto JobSystem::Find(std::size_t index) -> Job*
+	{
+		auto& worker = *m_Workers[index];
+
+		if (auto* job = worker.Jobs.Pop())
+			return job;
+
+		if (m_InjectedCount.load(std::memory_order_acquire) > 0)
+		{
+			std::scoped_lock lock{m_InjectedMutex};
+			if (!m_Injected.empty())
+			{
+				auto* job = m_Injected.back();
+				m_Injected.pop_back();
+				m_InjectedCount.fetch_sub(1, std::memory_order_release);
+				return job;
+			}
+		}
+
+		for (std::size_t i = 1; i < m_Workers.size(); ++i)
+		{
+			if (auto* job = m_Workers[(index + i) % m_Workers.size()]->Jobs.Steal())
+			{
+				worker.Stolen.fetch_add(1, std::memory_order_relaxed);
+				return job;
+			}
+		}
+
+		return nullptr;
+	}
+
+	auto JobSystem::Execute(Job& job, std::size_t index) -> void
+	{
+		// The job may be released by its owner as soon as its counter completes, so nothing is read afterwards.
+		auto* counter = job.m_Counter;
+		auto start = std::chrono::steady_clock::now();
+
+		job();
+
+		auto& worker = *m_Workers[index];
+		auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+		worker.BusyTime.fetch_add(static_cast<std::uint64_t>(elapsed.count()), std::memory_order_relaxed);
+		worker.Executed.fetch_add(1, std::memory_order_relaxed);
+
+		if (counter != nullptr)
+			Complete(*counter);
+	}
+
+	auto JobSystem::Complete(JobCounter& counter) -> void
+	{
+		counter.Lock();
+
+		Job* waiting{};
+		if (counter.m_Pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			waiting = std::exchange(counter.m_Waiting, nullptr);
+
+		counter.Unlock();
+
+		while (waiting != nullptr)
+			Push(*std::exchange(waiting, waiting->m_Next));
+	}
+
+	auto JobSystem::WorkerMain(std::size_t index) -> void
+	{
+		t_Slot = ThreadSlot{
+			.Owner = this,
+			.Index = index,
+		};
+
+		while (!m_Stopping.load(std::memory_order_acquire))
+		{
+			auto signal = m_Signal.load(std::memory_order_seq_cst);
+
+			auto* job = Find(index);
+			for (int spin = 0; job == nullptr && spin < SpinCount; ++spin)
+			{
+				std::this_thread::yield();
+				job = Find(index);
+			}
+
+			if (job != nullptr)
+			{
+				Execute(*job, index);
+				continue;
+			}
+
+			m_Sleeping.fetch_add(1, std::memory_order_seq_cst);
+			m_Signal.wait(signal, std::memory_order_seq_cst);
+			m_Sleeping.fetch_sub(1, std::memory_order_seq_cst);
+		}
+	}
+} //namespace Star
@@ -0,0 +1,255 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Star
+{
+	/// @brief Assumed size of a cache line, used to keep data written by different threads apart.
+	inline constexpr std::size_t CacheLineSize = 64;
+
+	class Job;
+
+	/// @brief Counter tracking the completion of scheduled jobs.
+	/// @details A counter doubles as a fence: jobs may be scheduled to only start once a counter reaches zero.
+	class JobCounter
+	{
+	public:
+		/// @brief Check if all tracked jobs have completed.
+		/// @return @c true if no tracked job is pending, @c false otherwise.
+		[[nodiscard]] auto Done() const -> bool;
+
+	private:
+		friend class JobSystem;
+
+		auto Lock() -> void;
+
+		auto Unlock() -> void;
+
+		std::atomic<std::size_t> m_Pending{};
+		std::atomic_flag m_Locked{};
+		Job* m_Waiting{};
+	};
+
+	/// @brief A unit of work executed by the job system.
+	/// @details Jobs only reference their function and are not owned by the job system, so they have to outlive
+	/// their execution. Jobs must not throw.
+	class Job
+	{
+	public:
+		/// @brief Create an empty job.
+		Job() = default;
+
+		/// @brief Create a job invoking a function with a data pointer.
+		/// @param function Function to invoke.
+		/// @param data Data passed to the function.
+		Job(void (*function)(void*), void* data);
+
+		/// @brief Create a job invoking a callable object.
+		/// @tparam TFunction Callable type.
+		/// @param function Callable object, which has to outlive the job execution.
+		template <std::invocable TFunction>
+		explicit Job(TFunction& function) :
+			Job{&Invoke<TFunction>, std::addressof(function)}
+		{
+		}
+
+		/// @brief Execute the job.
+		auto operator()() const -> void;
+
+	private:
+		friend class JobSystem;
+
+		template <typename TFunction>
+		static auto Invoke(void* data) -> void
+		{
+			(*static_cast<TFunction*>(data))();
+		}
+
+		void (*m_Function)(void*){};
+		void* m_Data{};
+		JobCounter* m_Counter{};
+		Job* m_Next{};
+	};
+
+	/// @brief Utilisation statistics of a single job system thread.
+	struct WorkerStats
+	{
+		/// @brief Fraction of wall time spent executing jobs since the previous collection.
+		double Utilization{};
+
+		/// @brief Number of jobs executed since the previous collection.
+		std::uint64_t Executed{};
+
+		/// @brief Number of jobs stolen from other threads since the previous collection.
+		std::uint64_t Stolen{};
+	};
+
+	/// @brief Work-stealing job system.
+	/// @details Each worker thread owns a deque it pushes to and pops from, while idle threads steal from the other
+	/// end of foreign deques. The thread creating the job system, or the thread it was last bound to, owns slot @c 0
+	/// and participates in the work while waiting; it is also the only thread executing main thread jobs. Other
+	/// threads may schedule and wait for jobs, but never execute any.
+	class JobSystem
+	{
+	public:
+		/// @brief Create a job system owned by the calling thread.
+		/// @param workerCount Number of worker threads to spawn in addition to the calling thread.
+		explicit JobSystem(std::size_t workerCount = DefaultWorkerCount());
+
+		/// @brief Destructor.
+		~JobSystem();
+
+		/// @brief Copy constructor.
+		/// @param other Job system to copy from.
+		JobSystem(const JobSystem& other) = delete;
+
+		/// @brief Move constructor.
+		/// @param other Job system to move from.
+		JobSystem(JobSystem&& other) = delete;
+
+		/// @brief Copy operator.
+		/// @param other Job system to copy from.
+		/// @return Reference to the current job system.
+		auto operator=(const JobSystem& other) -> JobSystem& = delete;
+
+		/// @brief Move operator.
+		/// @param other Job system to move from.
+		/// @return Reference to the current job system.
+		auto operator=(JobSystem&& other) -> JobSystem& = delete;
+
+		/// @brief Make the calling thread the owner of the job system.
+		/// @details Used when the thread updating the application differs from the one that created it. The previous
+		/// owner loses slot @c 0 and must not be waiting for jobs while ownership moves.
+		auto Bind() -> void;
+
+		/// @brief Get the default number of worker threads for this machine.
+		/// @return One less than the number of hardware threads.
+		[[nodiscard]] static auto DefaultWorkerCount() -> std::size_t;
+
+		/// @brief Get the number of worker threads.
+		/// @return Number of worker threads, excluding the owning thread.
+		[[nodiscard]] auto WorkerCount() const -> std::size_t;
+
+		/// @brief Get the number of threads executing jobs.
+		/// @return Number of worker threads, including the owning thread.
+		[[nodiscard]] auto ThreadCount() const -> std::size_t;
+
+		/// @brief Get the index of the calling thread.
+		/// @return @c 0 for the owning thread and threads foreign to this job system, otherwise the worker slot in
+		/// <tt>[1, ThreadCount())</tt>.
+		[[nodiscard]] auto ThreadIndex() const -> std::size_t;
+
+		/// @brief Check if the calling thread executes jobs of this job system.
+		/// @return @c true for the owning thread and the workers, @c false for foreign threads.
+		[[nodiscard]] auto Participates() const -> bool;
+
+		/// @brief Schedule a job.
+		/// @param job Job to execute, which has to outlive its execution.
+		/// @param counter Counter incremented now and decremented once the job has completed.
+		/// @param dependency Counter that has to reach zero before the job starts.
+		auto Schedule(Job& job, JobCounter* counter = nullptr, JobCounter* dependency = nullptr) -> void;
+
+		/// @brief Wait for a counter to reach zero.
+		/// @details The owning thread and workers execute other jobs while waiting.
+		/// @param counter Counter to wait for.
+		auto Wait(JobCounter& counter) -> void;
+
+		/// @brief Schedule a function to be executed on the owning thread.
+		/// @details Intended for work that has to run on the thread updating the application, like changes to the
+		/// main world. Platform calls use @c Main::SchedulePlatform instead, since the application may be updated
+		/// off the platform thread.
+		/// @param function Function to execute.
+		/// @param counter Counter incremented now and decremented once the function has completed.
+		auto ScheduleMain(std::function<void()> function, JobCounter* counter = nullptr) -> void;
+
+		/// @brief Execute all pending main thread functions.
+		/// @details Must only be called on the owning thread.
+		/// @return Number of executed functions.
+		auto RunMainJobs() -> std::size_t;
+
+		/// @brief Collect the utilisation of all threads since the previous collection.
+		/// @return Statistics indexed by thread index.
+		[[nodiscard]] auto CollectStats() -> std::vector<WorkerStats>;
+
+		/// @brief Invoke a function for every index in a range and wait for completion.
+		/// @details Exceptions thrown by the function are rethrown once all indices have been processed.
+		/// @tparam TFunction Function type.
+		/// @param count Number of indices to process.
+		/// @param function Function invoked with each index in <tt>[0, count)</tt>.
+		template <std::invocable<std::size_t> TFunction>
+		auto ParallelFor(std::size_t count, TFunction function) -> void
+		{
+			ParallelRange(count, 1, [&](std::size_t begin, std::size_t end) {
+				for (auto index = begin; index < end; ++index)
+					function(index);
+			});
+		}
+
+		/// @brief Invoke a function for consecutive chunks of a range and wait for completion.
+		/// @details Exceptions thrown by the function are rethrown once all chunks have been processed.
+		/// @tparam TFunction Function type.
+		/// @param count Number of indices to process.
+		/// @param grain Number of indices per chunk.
+		/// @param function Function invoked with the bounds <tt>[begin, end)</tt> of each chunk.
+		template <std::invocable<std::size_t, std::size_t> TFunction>
+		auto ParallelRange(std::size_t count, std::size_t grain, TFunction function) -> void
+		{
+			Run(count, grain, &InvokeRange<TFunction>, std::addressof(function));
+		}
+
+	private:
+		using RangeFunction = void (*)(void*, std::size_t, std::size_t);
+
+		struct Deque;
+		struct Worker;
+		struct Range;
+
+		static constexpr std::size_t MaxRangeJobs = 64;
+
+		template <typename TFunction>
+		static auto InvokeRange(void* data, std::size_t begin, std::size_t end) -> void
+		{
+			(*static_cast<TFunction*>(data))(begin, end);
+		}
+
+		auto Run(std::size_t count, std::size_t grain, RangeFunction function, void* data) -> void;
+
+		auto Push(Job& job) -> void;
+
+		[[nodiscard]] auto Find(std::size_t index) -> Job*;
+
+		auto Execute(Job& job, std::size_t index) -> void;
+
+		auto Complete(JobCounter& counter) -> void;
+
+		auto WorkerMain(std::size_t index) -> void;
+
+		std::vector<std::unique_ptr<Worker>> m_Workers{};
+		std::vector<std::thread> m_Threads{};
+		std::atomic<std::thread::id> m_Owner{};
+
+		std::mutex m_InjectedMutex{};
+		std::vector<Job*> m_Injected{};
+		std::atomic<std::size_t> m_InjectedCount{};
+
+		std::mutex m_MainMutex{};
+		std::vector<std::pair<std::function<void()>, JobCounter*>> m_MainJobs{};
+		std::vector<std::pair<std::function<void()>, JobCounter*>> m_MainJobsRunning{};
+
+		alignas(CacheLineSize) std::atomic<std::uint32_t> m_Signal{};
+		std::atomic<std::size_t> m_Sleeping{};
+		std::atomic<bool> m_Stopping{};
+
+		std::chrono::steady_clock::time_point m_StatsTime{};
+	};
+} //namespace Star
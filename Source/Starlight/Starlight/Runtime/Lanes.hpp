@@ -0,0 +1,148 @@
+#pragma once
+
+#include <glm/fwd.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <new>
+#include <tuple>
+#include <type_traits>
+
+namespace Star
+{
+	/// @brief Width in bytes of the widest supported SIMD registers.
+	inline constexpr std::size_t SimdWidth = 32;
+
+	/// @brief Number of scalars of a type fitting into a SIMD register.
+	/// @tparam TScalar Scalar type.
+	template <typename TScalar>
+	inline constexpr std::size_t SimdLanes = std::max<std::size_t>(SimdWidth / sizeof(TScalar), 1);
+
+	/// @brief A list of component members stored in separate lanes.
+	/// @tparam TMembers Pointers to the members.
+	template <auto... TMembers>
+	struct LaneList
+	{
+		/// @brief Pointers to the members.
+		static constexpr auto Members = std::tuple{TMembers...};
+	};
+
+	/// @brief Check if a type is a lane list.
+	/// @tparam T Type to check.
+	template <typename T>
+	struct IsLaneList : std::false_type
+	{
+	};
+
+	/// @brief Check if a type is a lane list.
+	/// @tparam TMembers Pointers to the members.
+	template <auto... TMembers>
+	struct IsLaneList<LaneList<TMembers...>> : std::true_type
+	{
+	};
+
+	/// @brief Split of a member type into scalar lanes.
+	/// @tparam TType Member type.
+	template <typename TType>
+	struct LaneTraits;
+
+	/// @brief Split of a scalar member into a single lane.
+	/// @tparam TType Scalar type.
+	template <typename TType>
+	requires std::is_arithmetic_v<TType>
+	struct LaneTraits<TType>
+	{
+		/// @brief Scalar type of the lanes.
+		using Scalar = TType;
+
+		/// @brief Number of lanes.
+		static constexpr std::size_t Count = 1;
+
+		/// @brief Get the scalar of a lane.
+		/// @param value Member value.
+		/// @param lane Lane index.
+		/// @return A reference to the scalar.
+		[[nodiscard]] static auto Get(TType& value, [[maybe_unused]] std::size_t lane) -> Scalar&
+		{
+			return value;
+		}
+	};
+
+	/// @brief Split of a vector member into a lane per component.
+	/// @tparam TLength Number of vector components.
+	/// @tparam TType Vector component type.
+	/// @tparam TQualifier Vector precision qualifier.
+	template <glm::length_t TLength, typename TType, glm::qualifier TQualifier>
+	requires std::is_arithmetic_v<TType>
+	struct LaneTraits<glm::vec<TLength, TType, TQualifier>>
+	{
+		/// @brief Scalar type of the lanes.
+		using Scalar = TType;
+
+		/// @brief Number of lanes.
+		static constexpr std::size_t Count = TLength;
+
+		/// @brief Get the scalar of a lane.
+		/// @param value Member value.
+		/// @param lane Lane index.
+		/// @return A reference to the scalar.
+		[[nodiscard]] static auto Get(glm::vec<TLength, TType, TQualifier>& value, std::size_t lane) -> Scalar&
+		{
+			return value[static_cast<glm::length_t>(lane)];
+		}
+	};
+
+	/// @brief Check if a component opts into structure-of-arrays storage.
+	/// @details Components opt in by declaring a @c Lanes member type listing the members to store, each of which
+	/// has to be a scalar or a @c glm vector. Members that are not listed are not stored.
+	/// @tparam TType Component type.
+	template <typename TType>
+	concept LaneComponent = requires { typename TType::Lanes; } && IsLaneList<typename TType::Lanes>::value &&
+		std::default_initializable<TType>;
+
+	/// @brief Allocator aligning storage to the SIMD width.
+	/// @tparam TType Allocated type.
+	template <typename TType>
+	class LaneAllocator
+	{
+	public:
+		/// @brief Allocated type.
+		using value_type = TType; // NOLINT(readability-identifier-naming)
+
+		/// @brief Create a lane allocator.
+		LaneAllocator() = default;
+
+		/// @brief Create a lane allocator from one of another type.
+		/// @tparam TOther Allocated type of the other allocator.
+		/// @param other Allocator to copy from.
+		template <typename TOther>
+		LaneAllocator( // NOLINT(google-explicit-constructor)
+			[[maybe_unused]] const LaneAllocator<TOther>& other
+		) noexcept
+		{
+		}
+
+		/// @brief Allocate uninitialized storage.
+		/// @param count Number of objects.
+		/// @return Pointer to the storage.
+		[[nodiscard]] auto allocate(std::size_t count) -> TType* // NOLINT(readability-identifier-naming)
+		{
+			return static_cast<TType*>(::operator new(count * sizeof(TType), std::align_val_t{SimdWidth}));
+		}
+
+		/// @brief Deallocate storage.
+		/// @param data Pointer to the storage.
+		/// @param count Number of objects.
+		auto deallocate(TType* data, std::size_t count) -> void // NOLINT(readability-identifier-naming)
+		{
+			::operator delete(data, count * sizeof(TType), std::align_val_t{SimdWidth});
+		}
+
+		/// @brief Equality operator.
+		/// @param lhs Left comparison instance.
+		/// @param rhs Right comparison instance.
+		/// @return Always @c true, as allocators are stateless.
+		[[nodiscard]] friend auto operator==(const LaneAllocator& lhs, const LaneAllocator& rhs) -> bool = default;
+	};
+} //namespace Star
@@ -0,0 +1,214 @@
+#include "Memory.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <numeric>
+
+namespace
+{
+	using namespace Star;
+
+#if defined(STARLIGHT_COUNT_ALLOCATIONS)
+	constinit std::atomic<std::uint64_t> g_HeapAllocations{};
+	constinit std::atomic<std::uint64_t> g_HeapBytes{};
+
+	[[nodiscard]] auto CountedAllocate(std::size_t size, std::size_t alignment) -> void*
+	{
+		g_HeapAllocations.fetch_add(1, std::memory_order_relaxed);
+		g_HeapBytes.fetch_add(size, std::memory_order_relaxed);
+
+		size = std::max<std::size_t>(size, 1);
+
+		void* data{};
+		if (alignment <= alignof(std::max_align_t))
+			data = std::malloc(size); // NOLINT(*-no-malloc, *-owning-memory)
+		else
+		{
+#if defined(_WIN32)
+			data = _aligned_malloc(size, alignment);
+#else
+			// The size has to be a multiple of the alignment.
+			data = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+#endif
+		}
+
+		if (data == nullptr)
+			throw std::bad_alloc{};
+
+		return data;
+	}
+
+	auto CountedFree(void* data, std::size_t alignment) -> void
+	{
+#if defined(_WIN32)
+		if (alignment > alignof(std::max_align_t))
+		{
+			_aligned_free(data);
+			return;
+		}
+#else
+		static_cast<void>(alignment);
+#endif
+
+		std::free(data); // NOLINT(*-no-malloc, *-owning-memory)
+	}
+#endif
+} //namespace
+
+#if defined(STARLIGHT_COUNT_ALLOCATIONS)
+// The replacements live in the same translation unit as the frame allocator, which the application always links, so
+// they are never dropped from the static library. Array and non-throwing variants forward to these by default.
+auto operator new(std::size_t size) -> void*
+{
+	return CountedAllocate(size, alignof(std::max_align_t));
+}
+
+auto operator new(std::size_t size, std::align_val_t alignment) -> void*
+{
+	return CountedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+auto operator delete(void* data) noexcept -> void
+{
+	CountedFree(data, alignof(std::max_align_t));
+}
+
+auto operator delete(void* data, [[maybe_unused]] std::size_t size) noexcept -> void
+{
+	CountedFree(data, alignof(std::max_align_t));
+}
+
+auto operator delete(void* data, std::align_val_t alignment) noexcept -> void
+{
+	CountedFree(data, static_cast<std::size_t>(alignment));
+}
+
+auto operator delete(void* data, [[maybe_unused]] std::size_t size, std::align_val_t alignment) noexcept -> void
+{
+	CountedFree(data, static_cast<std::size_t>(alignment));
+}
+#endif
+
+namespace Star
+{
+	auto CurrentHeapStats() -> HeapStats
+	{
+#if defined(STARLIGHT_COUNT_ALLOCATIONS)
+		return {
+			.Allocations = g_HeapAllocations.load(std::memory_order_relaxed),
+			.Bytes = g_HeapBytes.load(std::memory_order_relaxed),
+		};
+#else
+		return {};
+#endif
+	}
+
+	auto FrameArena::Allocate(std::size_t size, std::size_t alignment) -> void*
+	{
+		for (; m_Block < m_Blocks.size(); ++m_Block, m_Offset = 0)
+		{
+			auto& block = m_Blocks[m_Block];
+
+			void* data = block.Data.get() + m_Offset;
+			auto space = block.Size - m_Offset;
+
+			if (std::align(alignment, size, data, space) != nullptr)
+			{
+				auto offset = block.Size - space + size;
+				m_Used += offset - m_Offset;
+				m_Offset = offset;
+				return data;
+			}
+		}
+
+		auto blockSize = std::max(BlockSize, size + alignment);
+		m_Blocks.push_back(Block{
+			.Data = std::make_unique_for_overwrite<std::byte[]>(blockSize),
+			.Size = blockSize,
+		});
+
+		return Allocate(size, alignment);
+	}
+
+	auto FrameArena::Reset() -> void
+	{
+		m_Block = 0;
+		m_Offset = 0;
+		m_Used = 0;
+	}
+
+	auto FrameArena::Used() const -> std::size_t
+	{
+		return m_Used;
+	}
+
+	auto FrameArena::Capacity() const -> std::size_t
+	{
+		return std::accumulate(m_Blocks.begin(), m_Blocks.end(), std::size_t{}, [](auto sum, const Block& block) {
+			return sum + block.Size;
+		});
+	}
+
+	auto FrameArena::do_allocate(std::size_t size, std::size_t alignment) -> void*
+	{
+		return Allocate(size, alignment);
+	}
+
+	auto FrameArena::do_deallocate(
+		[[maybe_unused]] void* data,
+		[[maybe_unused]] std::size_t size,
+		[[maybe_unused]] std::size_t alignment
+	) -> void
+	{
+	}
+
+	auto FrameArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool
+	{
+		return this == &other;
+	}
+
+	FrameAllocator::FrameAllocator(const JobSystem* jobs) :
+		m_Jobs{jobs}
+	{
+		m_Arenas.resize(jobs != nullptr ? jobs->ThreadCount() : 1);
+		for (auto& arena : m_Arenas)
+			arena = std::make_unique<FrameArena>();
+	}
+
+	auto FrameAllocator::Local() -> FrameArena&
+	{
+		if (m_Jobs == nullptr || m_Jobs->Participates())
+			return *m_Arenas[m_Jobs != nullptr ? m_Jobs->ThreadIndex() : 0];
+
+		std::scoped_lock lock{m_ForeignMutex};
+
+		auto thread = std::this_thread::get_id();
+		auto foreign = std::ranges::find(m_Foreign, thread, &decltype(m_Foreign)::value_type::first);
+		if (foreign != m_Foreign.end())
+			return *foreign->second;
+
+		return *m_Foreign.emplace_back(thread, std::make_unique<FrameArena>()).second;
+	}
+
+	auto FrameAllocator::Reset() -> void
+	{
+		for (auto& arena : m_Arenas)
+			arena->Reset();
+
+		for (auto& [thread, arena] : m_Foreign)
+			arena->Reset();
+	}
+
+	auto FrameAllocator::Used() const -> std::size_t
+	{
+		auto used = std::accumulate(m_Arenas.begin(), m_Arenas.end(), std::size_t{}, [](auto sum, const auto& arena) {
+			return sum + arena->Used();
+		});
+
+		for (const auto& [thread, arena] : m_Foreign)
+			used += arena->Used();
+
+		return used;
+	}
+} //namespace Star
@@ -0,0 +1,283 @@
+#pragma once
+
+#include "Starlight/Runtime/Job.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Star
+{
+	/// @brief Global heap allocation statistics.
+	struct HeapStats
+	{
+		/// @brief Number of allocations.
+		std::uint64_t Allocations{};
+
+		/// @brief Number of allocated bytes.
+		std::uint64_t Bytes{};
+	};
+
+	/// @brief Get the global heap allocations made since the start of the program.
+	/// @details Only counted when built with @c STARLIGHT_COUNT_ALLOCATIONS, which replaces the global allocation
+	/// functions, otherwise always empty.
+	/// @return Cumulative statistics.
+	[[nodiscard]] auto CurrentHeapStats() -> HeapStats;
+
+	/// @brief Linear allocator releasing all of its allocations at once.
+	/// @details Memory is bumped out of blocks that are kept across resets, so once the arena has grown to the peak
+	/// usage between two resets, allocations no longer reach the global heap. Destructors of allocated objects are
+	/// never run.
+	///
+	/// The arena is a polymorphic memory resource, so standard @c pmr containers can allocate from it directly;
+	/// deallocation is a no-op.
+	class FrameArena : public std::pmr::memory_resource
+	{
+	public:
+		/// @brief Size in bytes of the blocks allocated from the global heap.
+		static constexpr std::size_t BlockSize = std::size_t{64} * 1024;
+
+		/// @brief Create an empty arena.
+		FrameArena() = default;
+
+		/// @brief Destructor.
+		~FrameArena() override = default;
+
+		/// @brief Copy constructor.
+		/// @param other Arena to copy from.
+		FrameArena(const FrameArena& other) = delete;
+
+		/// @brief Move constructor.
+		/// @param other Arena to move from.
+		FrameArena(FrameArena&& other) = delete;
+
+		/// @brief Copy operator.
+		/// @param other Arena to copy from.
+		/// @return Reference to the current arena.
+		auto operator=(const FrameArena& other) -> FrameArena& = delete;
+
+		/// @brief Move operator.
+		/// @param other Arena to move from.
+		/// @return Reference to the current arena.
+		auto operator=(FrameArena&& other) -> FrameArena& = delete;
+
+		/// @brief Allocate uninitialized memory.
+		/// @param size Size in bytes.
+		/// @param alignment Alignment in bytes, a power of two.
+		/// @return Pointer to the memory, valid until the next reset.
+		[[nodiscard]] auto Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t)) -> void*;
+
+		/// @brief Allocate a value initialized array.
+		/// @tparam TType Element type.
+		/// @param count Number of elements.
+		/// @return The array, valid until the next reset.
+		template <typename TType>
+		requires std::is_trivially_destructible_v<TType>
+		[[nodiscard]] auto AllocateArray(std::size_t count) -> std::span<TType>
+		{
+			auto* data = static_cast<TType*>(Allocate(count * sizeof(TType), alignof(TType)));
+			std::uninitialized_value_construct_n(data, count);
+			return {data, count};
+		}
+
+		/// @brief Create an object.
+		/// @tparam TType Object type.
+		/// @tparam TArgs Object constructor argument types.
+		/// @param args Object constructor arguments.
+		/// @return A reference to the object, valid until the next reset.
+		template <typename TType, typename... TArgs>
+		requires std::is_trivially_destructible_v<TType>
+		[[nodiscard]] auto Create(TArgs&&... args) -> TType&
+		{
+			auto* data = Allocate(sizeof(TType), alignof(TType));
+			if constexpr (std::is_aggregate_v<TType>)
+				return *::new (data) TType{std::forward<TArgs>(args)...};
+			else
+				return *::new (data) TType(std::forward<TArgs>(args)...);
+		}
+
+		/// @brief Release all allocations, keeping the blocks for reuse.
+		auto Reset() -> void;
+
+		/// @brief Get the number of bytes handed out since the last reset, including alignment padding.
+		/// @return Number of bytes.
+		[[nodiscard]] auto Used() const -> std::size_t;
+
+		/// @brief Get the number of bytes held by the arena.
+		/// @return Number of bytes.
+		[[nodiscard]] auto Capacity() const -> std::size_t;
+
+	private:
+		struct Block
+		{
+			std::unique_ptr<std::byte[]> Data{};
+			std::size_t Size{};
+		};
+
+		auto do_allocate(std::size_t size, std::size_t alignment) -> void* override;
+
+		auto do_deallocate(void* data, std::size_t size, std::size_t alignment) -> void override;
+
+		[[nodiscard]] auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override;
+
+		std::vector<Block> m_Blocks{};
+		std::size_t m_Block{};
+		std::size_t m_Offset{};
+		std::size_t m_Used{};
+	};
+
+	/// @brief Per-thread frame arenas reset at the end of every application update.
+	/// @details Intended to be published as a @c FrameAllocator* entity manager singleton, so systems can take
+	/// scratch memory for the current frame from the arena of their thread without locking. Threads foreign to the
+	/// job system get an arena of their own on first use.
+	class FrameAllocator
+	{
+	public:
+		/// @brief Create a frame allocator.
+		/// @param jobs Job system whose threads allocate, @c nullptr for a single arena.
+		explicit FrameAllocator(const JobSystem* jobs = nullptr);
+
+		/// @brief Get the arena of the calling thread.
+		/// @return A reference to the arena.
+		[[nodiscard]] auto Local() -> FrameArena&;
+
+		/// @brief Reset all arenas.
+		/// @details Must not be called while memory is being allocated.
+		auto Reset() -> void;
+
+		/// @brief Get the number of bytes handed out by all arenas since the last reset.
+		/// @return Number of bytes.
+		[[nodiscard]] auto Used() const -> std::size_t;
+
+	private:
+		const JobSystem* m_Jobs{};
+		std::vector<std::unique_ptr<FrameArena>> m_Arenas{};
+
+		std::mutex m_ForeignMutex{};
+		std::vector<std::pair<std::thread::id, std::unique_ptr<FrameArena>>> m_Foreign{};
+	};
+
+	/// @brief Pool of fixed-size slots for objects of a single type.
+	/// @details Slots are carved out of blocks that are never returned to the global heap, and destroyed objects
+	/// leave their slot on a free list for the next creation. Objects still alive when the pool is destroyed are not
+	/// destructed.
+	/// @tparam TType Object type.
+	template <typename TType>
+	class ObjectPool
+	{
+	public:
+		/// @brief Number of slots per block.
+		static constexpr std::size_t BlockCount = 256;
+
+		/// @brief Create an empty pool.
+		ObjectPool() = default;
+
+		/// @brief Destructor.
+		~ObjectPool() = default;
+
+		/// @brief Copy constructor.
+		/// @param other Pool to copy from.
+		ObjectPool(const ObjectPool& other) = delete;
+
+		/// @brief Move constructor.
+		/// @param other Pool to move from.
+		ObjectPool(ObjectPool&& other) = delete;
+
+		/// @brief Copy operator.
+		/// @param other Pool to copy from.
+		/// @return Reference to the current pool.
+		auto operator=(const ObjectPool& other) -> ObjectPool& = delete;
+
+		/// @brief Move operator.
+		/// @param other Pool to move from.
+		/// @return Reference to the current pool.
+		auto operator=(ObjectPool&& other) -> ObjectPool& = delete;
+
+		/// @brief Create an object.
+		/// @tparam TArgs Object constructor argument types.
+		/// @param args Object constructor arguments.
+		/// @return Pointer to the object.
+		template <typename... TArgs>
+		[[nodiscard]] auto Create(TArgs&&... args) -> TType*
+		{
+			if (m_Free == nullptr)
+				Grow();
+
+			auto* slot = m_Free;
+			m_Free = slot->Next;
+
+			TType* object{};
+			try
+			{
+				if constexpr (std::is_aggregate_v<TType>)
+					object = ::new (static_cast<void*>(slot)) TType{std::forward<TArgs>(args)...};
+				else
+					object = ::new (static_cast<void*>(slot)) TType(std::forward<TArgs>(args)...);
+			}
+			catch (...)
+			{
+				Release(::new (static_cast<void*>(slot)) Slot{});
+				throw;
+			}
+
+			++m_Size;
+			return object;
+		}
+
+		/// @brief Destroy an object created by this pool.
+		/// @param object Pointer to the object.
+		auto Destroy(TType* object) -> void
+		{
+			std::destroy_at(object);
+			Release(::new (static_cast<void*>(object)) Slot{});
+			--m_Size;
+		}
+
+		/// @brief Get the number of live objects.
+		/// @return Number of objects.
+		[[nodiscard]] auto Size() const -> std::size_t
+		{
+			return m_Size;
+		}
+
+		/// @brief Get the number of slots held by the pool.
+		/// @return Number of slots.
+		[[nodiscard]] auto Capacity() const -> std::size_t
+		{
+			return m_Blocks.size() * BlockCount;
+		}
+
+	private:
+		union Slot
+		{
+			Slot* Next;
+			alignas(TType) std::byte Storage[sizeof(TType)]; // NOLINT(*-avoid-c-arrays)
+		};
+
+		auto Grow() -> void
+		{
+			auto& block = m_Blocks.emplace_back(std::make_unique_for_overwrite<Slot[]>(BlockCount));
+
+			for (auto index = BlockCount; index-- > 0;)
+				Release(::new (static_cast<void*>(&block[index])) Slot{});
+		}
+
+		auto Release(Slot* slot) -> void
+		{
+			slot->Next = m_Free;
+			m_Free = slot;
+		}
+
+		std::vector<std::unique_ptr<Slot[]>> m_Blocks{}; // NOLINT(*-avoid-c-arrays)
+		Slot* m_Free{};
+		std::size_t m_Size{};
+	};
+} //namespace Star
@@ -0,0 +1,294 @@
+#include "Profiler.hpp"
+
+#include "Starlight/Runtime/Job.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace
+{
+	using namespace Star;
+
+	/// Fields are relaxed atomics, as the collector may read a slot the recording thread is overwriting. Such
+	/// slots are detected and discarded after reading.
+	struct Zone
+	{
+		std::atomic<const char*> Name{};
+		std::atomic<std::uint64_t> Begin{};
+		std::atomic<std::uint64_t> End{};
+	};
+
+	struct Buffer
+	{
+		static constexpr std::size_t Capacity = std::size_t{1} << 14;
+
+		std::array<Zone, Capacity> Zones{};
+		alignas(CacheLineSize) std::atomic<std::uint64_t> Head{};
+		std::uint64_t Tail{};
+		std::uint32_t Thread{};
+	};
+
+	struct Captured
+	{
+		const char* Name{};
+		std::uint64_t Begin{};
+		std::uint64_t End{};
+		std::uint32_t Thread{};
+	};
+
+	struct Rolling
+	{
+		std::array<std::uint64_t, Profiler::StatsWindow> Durations{};
+		std::uint64_t Count{};
+	};
+
+	struct State
+	{
+		std::mutex Mutex{};
+		std::vector<std::unique_ptr<Buffer>> Buffers{};
+		std::unordered_set<std::string> Names{};
+		std::unordered_map<const char*, Rolling> Samples{};
+		std::vector<Captured> Capture{};
+		std::vector<Captured> Scratch{};
+		bool Capturing{};
+	};
+
+	thread_local Buffer* t_Buffer{};
+
+	[[nodiscard]] auto GetState() -> State&
+	{
+		static State state{};
+		return state;
+	}
+
+	[[nodiscard]] auto GetBuffer() -> Buffer&
+	{
+		if (t_Buffer == nullptr)
+		{
+			auto& state = GetState();
+			std::scoped_lock lock{state.Mutex};
+
+			auto& buffer = state.Buffers.emplace_back(std::make_unique<Buffer>());
+			buffer->Thread = static_cast<std::uint32_t>(state.Buffers.size());
+			t_Buffer = buffer.get();
+		}
+
+		return *t_Buffer;
+	}
+
+	auto Drain(State& state) -> void
+	{
+		for (auto& buffer : state.Buffers)
+		{
+			auto head = buffer->Head.load(std::memory_order_acquire);
+			auto tail = std::max(buffer->Tail, head > Buffer::Capacity ? head - Buffer::Capacity : 0);
+
+			// Reused across collections, so draining does not allocate once every zone name has been sampled.
+			auto& zones = state.Scratch;
+			zones.clear();
+			zones.reserve(Buffer::Capacity);
+
+			for (auto index = tail; index < head; ++index)
+			{
+				const auto& zone = buffer->Zones[index % Buffer::Capacity];
+				zones.push_back(Captured{
+					.Name = zone.Name.load(std::memory_order_relaxed),
+					.Begin = zone.Begin.load(std::memory_order_relaxed),
+					.End = zone.End.load(std::memory_order_relaxed),
+					.Thread = buffer->Thread,
+				});
+			}
+
+			// Slots the recording thread started overwriting while they were read are discarded.
+			std::atomic_thread_fence(std::memory_order_acquire);
+			auto written = buffer->Head.load(std::memory_order_relaxed) + 1;
+			auto discarded = written > Buffer::Capacity + tail ? written - Buffer::Capacity - tail : 0;
+			buffer->Tail = head;
+
+			for (const auto& zone : std::span{zones}.subspan(std::min<std::size_t>(discarded, zones.size())))
+			{
+				auto& samples = state.Samples[zone.Name];
+				samples.Durations[samples.Count % Profiler::StatsWindow] = zone.End - zone.Begin;
+				++samples.Count;
+
+				if (state.Capturing)
+					state.Capture.push_back(zone);
+			}
+		}
+	}
+
+	auto WriteString(std::ostream& stream, std::string_view string) -> void
+	{
+		stream << '"';
+
+		for (auto character : string)
+		{
+			switch (character)
+			{
+			case '"':
+				stream << "\\\"";
+				break;
+
+			case '\\':
+				stream << "\\\\";
+				break;
+
+			default:
+				if (static_cast<unsigned char>(character) < 0x20)
+					stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int{character} << std::dec;
+				else
+					stream << character;
+				break;
+			}
+		}
+
+		stream << '"';
+	}
+} //namespace
+
+namespace Star
+{
+	auto Profiler::Intern(std::string_view name) -> const char*
+	{
+		auto& state = GetState();
+		std::scoped_lock lock{state.Mutex};
+
+		return state.Names.emplace(name).first->c_str();
+	}
+
+	auto Profiler::Collect() -> void
+	{
+		auto& state = GetState();
+		std::scoped_lock lock{state.Mutex};
+
+		Drain(state);
+	}
+
+	auto Profiler::Stats() -> std::vector<ZoneStats>
+	{
+		auto& state = GetState();
+		std::scoped_lock lock{state.Mutex};
+
+		std::vector<ZoneStats> result{};
+		result.reserve(state.Samples.size());
+
+		for (const auto& [name, samples] : state.Samples)
+		{
+			auto count = std::min<std::size_t>(samples.Count, StatsWindow);
+			std::array<std::uint64_t, StatsWindow> durations{};
+			std::copy_n(samples.Durations.begin(), count, durations.begin());
+
+			auto recent = std::span{durations}.first(count);
+			auto percentile = recent.begin() + static_cast<std::ptrdiff_t>((count - 1) * 99 / 100);
+			std::ranges::nth_element(recent, percentile);
+
+			std::uint64_t total{};
+			for (auto duration : recent)
+				total += duration;
+
+			constexpr auto Seconds = 1e-9;
+			result.push_back(ZoneStats{
+				.Name = name,
+				.Min = static_cast<double>(std::ranges::min(recent)) * Seconds,
+				.Average = static_cast<double>(total) / static_cast<double>(count) * Seconds,
+				.P99 = static_cast<double>(*percentile) * Seconds,
+				.Count = samples.Count,
+			});
+		}
+
+		return result;
+	}
+
+	auto Profiler::BeginCapture() -> void
+	{
+		auto& state = GetState();
+		std::scoped_lock lock{state.Mutex};
+
+		Drain(state);
+		state.Capture.clear();
+		state.Capturing = true;
+	}
+
+	auto Profiler::EndCapture(std::ostream& stream) -> void
+	{
+		auto& state = GetState();
+		std::scoped_lock lock{state.Mutex};
+
+		Drain(state);
+		state.Capturing = false;
+
+		std::uint64_t epoch{};
+		if (!state.Capture.empty())
+			epoch = std::ranges::min(state.Capture, {}, &Captured::Begin).Begin;
+
+		auto flags = stream.flags();
+
+		stream << R"({"displayTimeUnit":"ms","traceEvents":[)";
+		stream << std::fixed << std::setprecision(3);
+
+		for (std::size_t i = 0; i < state.Capture.size(); ++i)
+		{
+			const auto& zone = state.Capture[i];
+
+			constexpr auto Microseconds = 1e-3;
+			stream << (i != 0 ? ",\n" : "\n") << R"({"name":)";
+			WriteString(stream, zone.Name);
+			stream << R"(,"ph":"X","pid":0,"tid":)" << zone.Thread;
+			stream << R"(,"ts":)" << static_cast<double>(zone.Begin - epoch) * Microseconds;
+			stream << R"(,"dur":)" << static_cast<double>(zone.End - zone.Begin) * Microseconds << '}';
+		}
+
+		stream << "\n]}\n";
+		stream.flags(flags);
+
+		state.Capture.clear();
+		state.Capture.shrink_to_fit();
+	}
+
+	auto Profiler::Capturing() -> bool
+	{
+		auto& state = GetState();
+		std::scoped_lock lock{state.Mutex};
+
+		return state.Capturing;
+	}
+
+	auto Profiler::Now() -> std::uint64_t
+	{
+		auto now = std::chrono::steady_clock::now().time_since_epoch();
+		return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+	}
+
+	auto Profiler::Record(const char* name, std::uint64_t begin, std::uint64_t end) -> void
+	{
+		auto& buffer = GetBuffer();
+		auto head = buffer.Head.load(std::memory_order_relaxed);
+
+		auto& zone = buffer.Zones[head % Buffer::Capacity];
+		zone.Name.store(name, std::memory_order_relaxed);
+		zone.Begin.store(begin, std::memory_order_relaxed);
+		zone.End.store(end, std::memory_order_relaxed);
+
+		buffer.Head.store(head + 1, std::memory_order_release);
+	}
+
+	ProfileZone::ProfileZone(const char* name) noexcept :
+		m_Name{name},
+		m_Begin{Profiler::Now()}
+	{
+	}
+
+	ProfileZone::~ProfileZone()
+	{
+		Profiler::Record(m_Name, m_Begin, Profiler::Now());
+	}
+} //namespace Star
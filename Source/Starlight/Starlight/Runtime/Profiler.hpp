@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+#define STAR_PROFILE_CONCAT_IMPL(lhs, rhs) lhs##rhs
+#define STAR_PROFILE_CONCAT(lhs, rhs) STAR_PROFILE_CONCAT_IMPL(lhs, rhs)
+
+#if defined(STARLIGHT_ENABLE_PROFILER)
+/// @brief Record a profiling zone until the end of the enclosing scope.
+/// @param name Zone name with static storage duration, such as a string literal or an interned name.
+#define STAR_PROFILE_ZONE(name) const ::Star::ProfileZone STAR_PROFILE_CONCAT(starProfileZone, __LINE__){name}
+#else
+#define STAR_PROFILE_ZONE(name) ((void)0)
+#endif
+
+namespace Star
+{
+	/// @brief Rolling statistics of a profiling zone.
+	struct ZoneStats
+	{
+		/// @brief Zone name.
+		std::string_view Name{};
+
+		/// @brief Shortest recent duration in seconds.
+		double Min{};
+
+		/// @brief Average recent duration in seconds.
+		double Average{};
+
+		/// @brief 99th percentile of recent durations in seconds.
+		double P99{};
+
+		/// @brief Total number of recorded zones.
+		std::uint64_t Count{};
+	};
+
+	/// @brief Frame profiler collecting zones recorded on any thread.
+	/// @details Zones are written to per-thread ring buffers without locking and drained by @c Collect, which should
+	/// be called once per frame. Zones overwritten before being collected are lost.
+	class Profiler
+	{
+	public:
+		/// @brief Number of recent durations per zone the rolling statistics are computed from.
+		static constexpr std::size_t StatsWindow = 128;
+
+		/// @brief Get a stable copy of a zone name.
+		/// @details Intended for names built at runtime, equal names share a single copy.
+		/// @param name Zone name.
+		/// @return Zone name with static storage duration.
+		[[nodiscard]] static auto Intern(std::string_view name) -> const char*;
+
+		/// @brief Drain the zones of all threads into the statistics and the active capture.
+		static auto Collect() -> void;
+
+		/// @brief Get the rolling statistics of all zones.
+		/// @return Statistics of every zone recorded so far.
+		[[nodiscard]] static auto Stats() -> std::vector<ZoneStats>;
+
+		/// @brief Start capturing collected zones.
+		static auto BeginCapture() -> void;
+
+		/// @brief Stop capturing and write the captured zones.
+		/// @param stream Stream receiving a Chrome trace event JSON document, as loaded by Perfetto.
+		static auto EndCapture(std::ostream& stream) -> void;
+
+		/// @brief Check if zones are being captured.
+		/// @return @c true between @c BeginCapture and @c EndCapture, @c false otherwise.
+		[[nodiscard]] static auto Capturing() -> bool;
+
+	private:
+		friend class ProfileZone;
+
+		[[nodiscard]] static auto Now() -> std::uint64_t;
+
+		static auto Record(const char* name, std::uint64_t begin, std::uint64_t end) -> void;
+	};
+
+	/// @brief Profiling zone recorded from its construction to its destruction.
+	/// @details Prefer @c STAR_PROFILE_ZONE, which compiles to nothing unless the profiler is enabled.
+	class ProfileZone
+	{
+	public:
+		/// @brief Begin a zone.
+		/// @param name Zone name with static storage duration.
+		explicit ProfileZone(const char* name) noexcept;
+
+		/// @brief End the zone.
+		~ProfileZone();
+
+		/// @brief Copy constructor.
+		/// @param other Zone to copy from.
+		ProfileZone(const ProfileZone& other) = delete;
+
+		/// @brief Move constructor.
+		/// @param other Zone to move from.
+		ProfileZone(ProfileZone&& other) = delete;
+
+		/// @brief Copy operator.
+		/// @param other Zone to copy from.
+		/// @return Reference to the current zone.
+		auto operator=(const ProfileZone& other) -> ProfileZone& = delete;
+
+		/// @brief Move operator.
+		/// @param other Zone to move from.
+		/// @return Reference to the current zone.
+		auto operator=(ProfileZone&& other) -> ProfileZone& = delete;
+
+	private:
+		const char* m_Name{};
+		std::uint64_t m_Begin{};
+	};
+} //namespace Star
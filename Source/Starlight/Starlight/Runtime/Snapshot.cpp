@@ -0,0 +1,196 @@
+#include "Snapshot.hpp"
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <iterator>
+
+namespace
+{
+	using namespace Star;
+
+	static_assert(sizeof(Entity) == sizeof(Entity::entity_type) && std::is_trivially_copyable_v<Entity>);
+
+	[[nodiscard]] constexpr auto Align(std::uint64_t offset) -> std::uint64_t
+	{
+		return (offset + SnapshotAlignment - 1) / SnapshotAlignment * SnapshotAlignment;
+	}
+
+	/// Writes blobs at increasing aligned offsets, padding the gaps with zeroes.
+	class BlobStream
+	{
+	public:
+		explicit BlobStream(std::ofstream& stream) :
+			m_Stream{&stream}
+		{
+		}
+
+		auto Write(std::uint64_t offset, std::span<const std::byte> data) -> void
+		{
+			static constexpr std::array<char, SnapshotAlignment> Padding{};
+
+			m_Stream->write(Padding.data(), static_cast<std::streamsize>(offset - m_Offset));
+
+			// NOLINTNEXTLINE(*-reinterpret-cast)
+			m_Stream->write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+			m_Offset = offset + data.size();
+		}
+
+	private:
+		std::ofstream* m_Stream{};
+		std::uint64_t m_Offset{};
+	};
+} //namespace
+
+namespace Star
+{
+	auto SnapshotWriter::Save(const std::filesystem::path& path) const -> void
+	{
+		std::vector<Entity> entities{};
+		for (const auto& pool : m_Pools)
+			entities.insert(entities.end(), pool.Entities.begin(), pool.Entities.end());
+
+		std::ranges::sort(entities);
+		entities.erase(std::ranges::unique(entities).begin(), entities.end());
+
+		SnapshotHeader header{
+			.EntityCount = entities.size(),
+			.EntityOffset = Align(sizeof(SnapshotHeader)),
+			.PoolCount = m_Pools.size(),
+		};
+
+		header.PoolOffset = Align(header.EntityOffset + entities.size() * sizeof(Entity));
+
+		std::vector<SnapshotPool> table{};
+		auto offset = header.PoolOffset + m_Pools.size() * sizeof(SnapshotPool);
+
+		for (const auto& pool : m_Pools)
+		{
+			auto& entry = table.emplace_back(pool.Header);
+			entry.EntityOffset = Align(offset);
+			entry.DataOffset = Align(entry.EntityOffset + pool.Entities.size() * sizeof(Entity));
+			offset = entry.DataOffset + pool.Data.size();
+		}
+
+		std::ofstream stream{path, std::ios::binary | std::ios::trunc};
+		if (!stream)
+			throw FileException{"Opening failed for " + path.string()};
+
+		BlobStream blobs{stream};
+		blobs.Write(0, std::as_bytes(std::span{&header, 1}));
+		blobs.Write(header.EntityOffset, std::as_bytes(std::span{entities}));
+		blobs.Write(header.PoolOffset, std::as_bytes(std::span{table}));
+
+		for (std::size_t i = 0; i < m_Pools.size(); ++i)
+		{
+			blobs.Write(table[i].EntityOffset, std::as_bytes(std::span{m_Pools[i].Entities}));
+			blobs.Write(table[i].DataOffset, m_Pools[i].Data);
+		}
+
+		if (!stream.flush())
+			throw FileException{"Writing failed for " + path.string()};
+	}
+
+	SnapshotFile::SnapshotFile(const std::filesystem::path& path) :
+		m_File{path}
+	{
+		auto data = m_File.Data();
+
+		auto contains = [&](std::uint64_t offset, std::uint64_t count, std::uint64_t size) {
+			return offset % SnapshotAlignment == 0 && offset <= data.size() && count <= (data.size() - offset) / size;
+		};
+
+		if (data.size() < sizeof(SnapshotHeader))
+			throw SnapshotException{"Snapshot is truncated"};
+
+		m_Header = reinterpret_cast<const SnapshotHeader*>(data.data()); // NOLINT(*-reinterpret-cast)
+		if (m_Header->Magic != SnapshotHeader::FileMagic || m_Header->Version != SnapshotHeader::FileVersion)
+			throw SnapshotException{"Snapshot format is not supported"};
+
+		if (!contains(m_Header->EntityOffset, m_Header->EntityCount, sizeof(Entity)) ||
+			!contains(m_Header->PoolOffset, m_Header->PoolCount, sizeof(SnapshotPool)))
+			throw SnapshotException{"Snapshot is truncated"};
+
+		// Tag components store no data, so their data offset may point past the end of the file.
+		for (const auto& pool : Pools())
+		{
+			if (!contains(pool.EntityOffset, pool.Count, sizeof(Entity)) ||
+				(pool.Size != 0 && !contains(pool.DataOffset, pool.Count, pool.Size)))
+				throw SnapshotException{"Snapshot is truncated"};
+		}
+	}
+
+	auto SnapshotFile::Entities() const -> std::span<const Entity>
+	{
+		// NOLINTNEXTLINE(*-reinterpret-cast)
+		return {reinterpret_cast<const Entity*>(m_File.Data().data() + m_Header->EntityOffset), m_Header->EntityCount};
+	}
+
+	auto SnapshotFile::Pools() const -> std::span<const SnapshotPool>
+	{
+		const auto* data = m_File.Data().data() + m_Header->PoolOffset;
+		return {reinterpret_cast<const SnapshotPool*>(data), m_Header->PoolCount}; // NOLINT(*-reinterpret-cast)
+	}
+
+	auto SnapshotFile::PoolEntities(const SnapshotPool& pool) const -> std::span<const Entity>
+	{
+		// NOLINTNEXTLINE(*-reinterpret-cast)
+		return {reinterpret_cast<const Entity*>(m_File.Data().data() + pool.EntityOffset), pool.Count};
+	}
+
+	auto SnapshotFile::Find(entt::id_type type, std::size_t size, std::size_t alignment) const -> const SnapshotPool*
+	{
+		auto pools = Pools();
+		auto pool = std::ranges::find(pools, type, &SnapshotPool::Type);
+
+		if (pool == pools.end())
+			return nullptr;
+
+		if (pool->Size != size || pool->Alignment != alignment)
+			throw SnapshotException{"Snapshot component layout does not match"};
+
+		return std::to_address(pool);
+	}
+
+	SnapshotLoader::SnapshotLoader(const SnapshotFile& file, EntityManager& entities) :
+		m_File{&file},
+		m_Entities{&entities}
+	{
+	}
+
+	auto SnapshotLoader::Done() const -> bool
+	{
+		return m_Created && m_Pool >= m_File->Pools().size();
+	}
+
+	auto SnapshotLoader::CreateEntities(std::size_t chunkSize) -> std::size_t
+	{
+		auto entities = m_File->Entities();
+		auto count = std::min(chunkSize, entities.size() - m_Offset);
+
+		for (auto entity : entities.subspan(m_Offset, count))
+		{
+			if (m_Entities->Create(entity) != entity)
+				throw SnapshotException{"Snapshot entity is already in use"};
+		}
+
+		m_Offset += count;
+		if (m_Offset == entities.size())
+		{
+			m_Created = true;
+			m_Offset = 0;
+		}
+
+		return count;
+	}
+
+	auto SnapshotLoader::Advance(std::size_t count) -> void
+	{
+		m_Offset += count;
+		if (m_Offset < m_File->Pools()[m_Pool].Count)
+			return;
+
+		++m_Pool;
+		m_Offset = 0;
+	}
+} //namespace Star
@@ -0,0 +1,307 @@
+#pragma once
+
+#include "Starlight/Platform/MappedFile.hpp"
+#include "Starlight/Runtime/Entity.hpp"
+
+#include <entt/core/type_info.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace Star
+{
+	/// @brief Alignment in bytes of every blob in a snapshot file.
+	inline constexpr std::size_t SnapshotAlignment = 64;
+
+	/// @brief Exception raised when a snapshot specific error happens.
+	struct SnapshotException : std::runtime_error
+	{
+		using runtime_error::runtime_error;
+	};
+
+	/// @brief Check if a component can be stored in a snapshot.
+	/// @details Components are stored as their raw bytes, so they must not reference memory outside of themselves.
+	/// Entity handles are preserved, so components may reference other entities.
+	/// @tparam TType Component type.
+	template <typename TType>
+	concept SnapshotComponent =
+		std::is_trivially_copyable_v<TType> && !LaneComponent<TType> && alignof(TType) <= SnapshotAlignment;
+
+	/// @brief Header at the start of a snapshot file.
+	/// @details Followed by the entity handles, the pool table and the entity handles and components of each pool,
+	/// each aligned to @c SnapshotAlignment. All offsets are relative to the start of the file.
+	struct SnapshotHeader
+	{
+		/// @brief Identifier of snapshot files.
+		static constexpr std::uint32_t FileMagic = 0x4E535453; // NOLINT(*-magic-numbers) "STSN"
+
+		/// @brief Current format version.
+		static constexpr std::uint32_t FileVersion = 1;
+
+		/// @brief Identifier of snapshot files, @c FileMagic.
+		std::uint32_t Magic{FileMagic};
+
+		/// @brief Format version.
+		std::uint32_t Version{FileVersion};
+
+		/// @brief Number of entities.
+		std::uint64_t EntityCount{};
+
+		/// @brief Offset of the entity handles.
+		std::uint64_t EntityOffset{};
+
+		/// @brief Number of component pools.
+		std::uint64_t PoolCount{};
+
+		/// @brief Offset of the pool table.
+		std::uint64_t PoolOffset{};
+	};
+
+	/// @brief Entry of the pool table of a snapshot file.
+	struct SnapshotPool
+	{
+		/// @brief Component type index.
+		entt::id_type Type{};
+
+		/// @brief Size in bytes of a component, @c 0 for empty components.
+		std::uint32_t Size{};
+
+		/// @brief Alignment in bytes of a component.
+		std::uint32_t Alignment{};
+
+		/// @brief Reserved, always @c 0.
+		std::uint32_t Reserved{};
+
+		/// @brief Number of components.
+		std::uint64_t Count{};
+
+		/// @brief Offset of the entity handles.
+		std::uint64_t EntityOffset{};
+
+		/// @brief Offset of the components.
+		std::uint64_t DataOffset{};
+	};
+
+	/// @brief Builder of snapshot files.
+	/// @details Only entities with at least one of the added components are stored.
+	class SnapshotWriter
+	{
+	public:
+		/// @brief Add the component pools of an entity manager.
+		/// @details Components are copied, so the entity manager may change afterwards.
+		/// @tparam TComponents Component types to store.
+		/// @param entities Entity manager to read from.
+		/// @param components Component types to store.
+		template <SnapshotComponent... TComponents>
+		auto Add(const EntityManager& entities, [[maybe_unused]] ComponentList<TComponents...> components) -> void
+		{
+			(AddPool<TComponents>(entities), ...);
+		}
+
+		/// @brief Write the snapshot to a file.
+		/// @param path Path of the file, replaced if it exists.
+		/// @throws FileException If the file cannot be written.
+		auto Save(const std::filesystem::path& path) const -> void;
+
+	private:
+		struct Pool
+		{
+			SnapshotPool Header{};
+			std::vector<Entity> Entities{};
+			std::vector<std::byte> Data{};
+		};
+
+		template <typename TType>
+		auto AddPool(const EntityManager& entities) -> void
+		{
+			auto& pool = m_Pools.emplace_back();
+			pool.Header.Type = entt::type_hash<TType>::value();
+			pool.Header.Size = std::is_empty_v<TType> ? 0 : sizeof(TType);
+			pool.Header.Alignment = alignof(TType);
+
+			for (auto entity : entities.View(ComponentList<const TType>{}, ComponentList<>{}))
+			{
+				pool.Entities.push_back(entity);
+
+				if constexpr (!std::is_empty_v<TType>)
+				{
+					auto bytes = std::as_bytes(std::span{std::addressof(entities.GetComponent<TType>(entity)), 1});
+					pool.Data.insert(pool.Data.end(), bytes.begin(), bytes.end());
+				}
+			}
+
+			pool.Header.Count = pool.Entities.size();
+		}
+
+		std::vector<Pool> m_Pools{};
+	};
+
+	/// @brief Snapshot file mapped into memory.
+	/// @details Components can be used in place without restoring them into an entity manager. Snapshots are only
+	/// compatible with builds using the same component layouts and type indices.
+	class SnapshotFile
+	{
+	public:
+		/// @brief Map a snapshot file.
+		/// @param path Path of the file.
+		/// @throws FileException If the file cannot be mapped.
+		/// @throws SnapshotException If the file is not a valid snapshot.
+		explicit SnapshotFile(const std::filesystem::path& path);
+
+		/// @brief Get the entities of the snapshot.
+		/// @return Entity handles sorted in ascending order.
+		[[nodiscard]] auto Entities() const -> std::span<const Entity>;
+
+		/// @brief Get the pool table of the snapshot.
+		/// @return Pool table entries.
+		[[nodiscard]] auto Pools() const -> std::span<const SnapshotPool>;
+
+		/// @brief Get the entities with a component.
+		/// @tparam TType Component type.
+		/// @return Entity handles in the order of @c Components, empty if the component is not stored.
+		/// @throws SnapshotException If the stored component layout does not match.
+		template <SnapshotComponent TType>
+		[[nodiscard]] auto PoolEntities() const -> std::span<const Entity>
+		{
+			const auto* pool = Find<TType>();
+			return pool != nullptr ? PoolEntities(*pool) : std::span<const Entity>{};
+		}
+
+		/// @brief Get the stored components of a type.
+		/// @tparam TType Component type.
+		/// @return Components in the mapped file, empty if the component is not stored.
+		/// @throws SnapshotException If the stored component layout does not match.
+		template <SnapshotComponent TType>
+		requires(!std::is_empty_v<TType>)
+		[[nodiscard]] auto Components() const -> std::span<const TType>
+		{
+			const auto* pool = Find<TType>();
+			if (pool == nullptr)
+				return {};
+
+			// NOLINTNEXTLINE(*-reinterpret-cast)
+			return {reinterpret_cast<const TType*>(m_File.Data().data() + pool->DataOffset), pool->Count};
+		}
+
+		/// @brief Get the entities of a pool.
+		/// @param pool Pool table entry.
+		/// @return Entity handles in the order of the components.
+		[[nodiscard]] auto PoolEntities(const SnapshotPool& pool) const -> std::span<const Entity>;
+
+	private:
+		template <typename TType>
+		[[nodiscard]] auto Find() const -> const SnapshotPool*
+		{
+			return Find(entt::type_hash<TType>::value(), std::is_empty_v<TType> ? 0 : sizeof(TType), alignof(TType));
+		}
+
+		[[nodiscard]] auto Find(entt::id_type type, std::size_t size, std::size_t alignment) const
+			-> const SnapshotPool*;
+
+		MappedFile m_File;
+		const SnapshotHeader* m_Header{};
+	};
+
+	/// @brief Incremental restore of a snapshot into an entity manager.
+	/// @details Entities are recreated with their stored handles first, then components are bulk inserted pool by
+	/// pool. Restoring in chunks spreads the work over multiple frames; the target entity manager must not be
+	/// updated while a chunk is restored, but restoring into a separate world on the job system lets the current
+	/// world keep updating in the meantime.
+	class SnapshotLoader
+	{
+	public:
+		/// @brief Default number of entities or components restored per step.
+		static constexpr std::size_t DefaultChunkSize = 16384;
+
+		/// @brief Create a loader.
+		/// @param file Snapshot to restore, which has to outlive the loader.
+		/// @param entities Entity manager to restore into, which has to outlive the loader.
+		SnapshotLoader(const SnapshotFile& file, EntityManager& entities);
+
+		/// @brief Restore the next chunk of the snapshot.
+		/// @details Stored pools of component types that are not listed are skipped.
+		/// @tparam TComponents Component types to restore.
+		/// @param components Component types to restore.
+		/// @param chunkSize Maximum number of entities or components to restore.
+		/// @return @c true if the snapshot has been restored completely, @c false otherwise.
+		/// @throws SnapshotException If a stored entity handle is already in use.
+		template <SnapshotComponent... TComponents>
+		auto Step(
+			[[maybe_unused]] ComponentList<TComponents...> components,
+			std::size_t chunkSize = DefaultChunkSize
+		) -> bool
+		{
+			while (chunkSize > 0 && !Done())
+			{
+				if (!m_Created)
+				{
+					chunkSize -= CreateEntities(chunkSize);
+					continue;
+				}
+
+				const auto& pool = m_File->Pools()[m_Pool];
+				auto restored = std::size_t{};
+
+				auto listed = ((pool.Type == entt::type_hash<TComponents>::value() &&
+									(restored = Restore<TComponents>(pool, chunkSize), true)) ||
+					...);
+
+				chunkSize -= restored;
+				Advance(listed ? restored : pool.Count - m_Offset);
+			}
+
+			return Done();
+		}
+
+		/// @brief Restore the remainder of the snapshot.
+		/// @tparam TComponents Component types to restore.
+		/// @param components Component types to restore.
+		/// @throws SnapshotException If a stored entity handle is already in use.
+		template <SnapshotComponent... TComponents>
+		auto Load(ComponentList<TComponents...> components) -> void
+		{
+			while (!Step(components))
+			{
+			}
+		}
+
+		/// @brief Check if the snapshot has been restored completely.
+		/// @return @c true if done, @c false otherwise.
+		[[nodiscard]] auto Done() const -> bool;
+
+	private:
+		template <typename TType>
+		auto Restore(const SnapshotPool& pool, std::size_t chunkSize) -> std::size_t
+		{
+			auto count = std::min<std::size_t>(chunkSize, pool.Count - m_Offset);
+			auto entities = m_File->PoolEntities(pool).subspan(m_Offset, count);
+
+			if constexpr (std::is_empty_v<TType>)
+			{
+				for (auto entity : entities)
+					m_Entities->CreateComponent<TType>(entity);
+			}
+			else
+				m_Entities->CreateComponents<TType>(entities, m_File->Components<TType>().subspan(m_Offset, count));
+
+			return count;
+		}
+
+		auto CreateEntities(std::size_t chunkSize) -> std::size_t;
+
+		auto Advance(std::size_t count) -> void;
+
+		const SnapshotFile* m_File{};
+		EntityManager* m_Entities{};
+		std::size_t m_Pool{};
+		std::size_t m_Offset{};
+		bool m_Created{};
+	};
+} //namespace Star
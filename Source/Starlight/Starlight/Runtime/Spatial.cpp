@@ -0,0 +1,557 @@
+#include "Spatial.hpp"
+
+#include "Starlight/Runtime/Profiler.hpp"
+
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <utility>
+
+namespace
+{
+	using namespace Star;
+
+	[[nodiscard]] auto LongestAxis(const Bounds& bounds) -> glm::length_t
+	{
+		auto extent = bounds.Max - bounds.Min;
+		if (extent.x >= extent.y && extent.x >= extent.z)
+			return 0;
+
+		return extent.y >= extent.z ? 1 : 2;
+	}
+} //namespace
+
+namespace Star
+{
+	auto Bounds::Merge(const Bounds& lhs, const Bounds& rhs) -> Bounds
+	{
+		return {glm::min(lhs.Min, rhs.Min), glm::max(lhs.Max, rhs.Max)};
+	}
+
+	auto Bounds::Center() const -> glm::vec3
+	{
+		return (Min + Max) * 0.5F; // NOLINT(*-magic-numbers)
+	}
+
+	auto Bounds::SurfaceArea() const -> float
+	{
+		auto extent = glm::max(Max - Min, glm::vec3{0.0F});
+		return 2.0F * (extent.x * extent.y + extent.y * extent.z + extent.z * extent.x);
+	}
+
+	auto Bounds::Overlaps(const Bounds& other) const -> bool
+	{
+		return Min.x <= other.Max.x && Max.x >= other.Min.x && Min.y <= other.Max.y && Max.y >= other.Min.y &&
+			Min.z <= other.Max.z && Max.z >= other.Min.z;
+	}
+
+	auto SpatialIndex::Build(std::span<const Entity> entities, std::span<const Bounds> bounds) -> void
+	{
+		std::vector<Item> items(entities.size());
+		for (std::size_t i = 0; i < entities.size(); ++i)
+			items[i] = {bounds[i], entities[i]};
+
+		Assemble(std::move(items));
+	}
+
+	auto SpatialIndex::Rebuild() -> void
+	{
+		Assemble(Gather());
+	}
+
+	auto SpatialIndex::Insert(Entity entity, const Bounds& bounds) -> bool
+	{
+		if (m_Indices.contains(static_cast<Entity::entity_type>(entity)))
+			return false;
+
+		if (m_Nodes.empty())
+		{
+			Assemble(std::vector<Item>{{bounds, entity}});
+			return true;
+		}
+
+		// Descend into the child whose surface area grows least, enlarging the nodes along the path.
+		std::uint32_t node{};
+		std::uint32_t depth = 1;
+
+		for (; m_Nodes[node].Count == 0; ++depth)
+		{
+			m_Nodes[node].Box = Bounds::Merge(m_Nodes[node].Box, bounds);
+
+			auto growth = [&](std::uint32_t child) {
+				const auto& box = m_Nodes[child].Box;
+				return Bounds::Merge(box, bounds).SurfaceArea() - box.SurfaceArea();
+			};
+
+			auto left = m_Nodes[node].First;
+			node = growth(left) <= growth(left + 1) ? left : left + 1;
+		}
+
+		if (m_Nodes[node].Count == LeafSize && depth >= MaxDepth - 1)
+		{
+			auto items = Gather();
+			items.push_back({bounds, entity});
+			Assemble(std::move(items));
+			return true;
+		}
+
+		m_Nodes[node].Box = Bounds::Merge(m_Nodes[node].Box, bounds);
+		++m_Size;
+
+		if (m_Nodes[node].Count == LeafSize)
+		{
+			SplitLeaf(node, {bounds, entity});
+			return true;
+		}
+
+		auto slot = m_Nodes[node].First + m_Nodes[node].Count++;
+		m_Items[slot] = {bounds, entity};
+		m_Indices.emplace(static_cast<Entity::entity_type>(entity), slot);
+		return true;
+	}
+
+	auto SpatialIndex::Remove(Entity entity) -> bool
+	{
+		auto it = m_Indices.find(static_cast<Entity::entity_type>(entity));
+		if (it == m_Indices.end())
+			return false;
+
+		auto slot = it->second;
+		m_Indices.erase(it);
+		--m_Size;
+
+		auto leaf = m_Leaves[slot / LeafSize];
+		auto& node = m_Nodes[leaf];
+		auto last = node.First + --node.Count;
+
+		if (slot != last)
+		{
+			m_Items[slot] = m_Items[last];
+			m_Indices[static_cast<Entity::entity_type>(m_Items[slot].Value)] = slot;
+		}
+
+		if (node.Count == 0)
+		{
+			Merge(leaf);
+			return true;
+		}
+
+		node.Box = Enclose(node.First, node.Count);
+		RefitPath(m_Parents[leaf]);
+		return true;
+	}
+
+	auto SpatialIndex::Update(Entity entity, const Bounds& bounds) -> bool
+	{
+		auto it = m_Indices.find(static_cast<Entity::entity_type>(entity));
+		if (it == m_Indices.end())
+			return false;
+
+		auto& box = m_Items[it->second].Box;
+		if (box.Min == bounds.Min && box.Max == bounds.Max)
+			return false;
+
+		box = bounds;
+		return true;
+	}
+
+	auto SpatialIndex::Refit() -> void
+	{
+		// Children are always stored after their parent, so a reverse pass visits them first.
+		for (auto index = m_Nodes.size(); index-- > 0;)
+		{
+			auto& node = m_Nodes[index];
+			if (node.First == NoNode)
+				continue;
+
+			if (node.Count != 0)
+				node.Box = Enclose(node.First, node.Count);
+			else
+				node.Box = Bounds::Merge(m_Nodes[node.First].Box, m_Nodes[node.First + 1].Box);
+		}
+	}
+
+	auto SpatialIndex::Cost() const -> float
+	{
+		auto cost = 0.0F;
+		for (const auto& node : m_Nodes)
+		{
+			if (node.Count == 0 && node.First != NoNode)
+				cost += node.Box.SurfaceArea();
+		}
+
+		return cost;
+	}
+
+	auto SpatialIndex::BuildCost() const -> float
+	{
+		return m_BuildCost;
+	}
+
+	auto SpatialIndex::Size() const -> std::size_t
+	{
+		return m_Size;
+	}
+
+	auto SpatialIndex::Nodes() const -> std::span<const Node>
+	{
+		return m_Nodes;
+	}
+
+	auto SpatialIndex::Overlap(const Bounds& bounds, std::vector<Entity>& result) const -> void
+	{
+		auto test = [&](const Bounds& box) { return box.Overlaps(bounds); };
+		Query(test, [&](Entity entity) { result.push_back(entity); });
+	}
+
+	auto SpatialIndex::Sphere(glm::vec3 center, float radius, std::vector<Entity>& result) const -> void
+	{
+		auto test = [&](const Bounds& box) {
+			auto offset = center - glm::clamp(center, box.Min, box.Max);
+			return glm::dot(offset, offset) <= radius * radius;
+		};
+
+		Query(test, [&](Entity entity) { result.push_back(entity); });
+	}
+
+	auto SpatialIndex::Ray(glm::vec3 origin, glm::vec3 direction, float distance, std::vector<Entity>& result) const
+		-> void
+	{
+		// Division by zero yields infinities, which the slab test handles without special cases.
+		auto inverse = glm::vec3{1.0F} / direction;
+
+		auto test = [&](const Bounds& box) {
+			auto near = 0.0F;
+			auto far = distance;
+
+			for (glm::length_t axis = 0; axis < 3; ++axis)
+			{
+				auto first = (box.Min[axis] - origin[axis]) * inverse[axis];
+				auto second = (box.Max[axis] - origin[axis]) * inverse[axis];
+
+				near = std::max(near, std::min(first, second));
+				far = std::min(far, std::max(first, second));
+			}
+
+			return near <= far;
+		};
+
+		Query(test, [&](Entity entity) { result.push_back(entity); });
+	}
+
+	auto SpatialIndex::Frustum(std::span<const glm::vec4, 6> planes, std::vector<Entity>& result) const -> void
+	{
+		// A box is outside if its corner furthest along the normal of any plane is behind that plane.
+		auto test = [&](const Bounds& box) {
+			return std::ranges::all_of(planes, [&](const glm::vec4& plane) {
+				glm::vec3 corner{
+					plane.x >= 0.0F ? box.Max.x : box.Min.x,
+					plane.y >= 0.0F ? box.Max.y : box.Min.y,
+					plane.z >= 0.0F ? box.Max.z : box.Min.z,
+				};
+
+				return glm::dot(glm::vec3{plane.x, plane.y, plane.z}, corner) + plane.w >= 0.0F;
+			});
+		};
+
+		Query(test, [&](Entity entity) { result.push_back(entity); });
+	}
+
+	auto SpatialIndex::Assemble(std::vector<Item> items) -> void
+	{
+		m_Nodes.clear();
+		m_Parents.clear();
+		m_Leaves.clear();
+		m_FreeNodes.clear();
+		m_FreeBlocks.clear();
+		m_Indices.clear();
+		m_Size = items.size();
+
+		if (items.empty())
+		{
+			m_Items.clear();
+			m_BuildCost = 0.0F;
+			return;
+		}
+
+		// A median split produces at most two nodes per leaf, which in turn hold at least half the leaf size.
+		m_Items = std::move(items);
+		m_Nodes.reserve(m_Items.size() / (LeafSize / 2) * 2 + 1);
+		m_Nodes.push_back({Enclose(0, static_cast<std::uint32_t>(m_Items.size())), 0,
+			static_cast<std::uint32_t>(m_Items.size())});
+		Split(0);
+
+		// Spread the entities of every leaf into a block of its own, so leaves can grow in place.
+		auto packed = std::exchange(m_Items, {});
+		m_Parents.assign(m_Nodes.size(), NoNode);
+
+		for (std::uint32_t index = 0; index < m_Nodes.size(); ++index)
+		{
+			auto& node = m_Nodes[index];
+			if (node.Count == 0)
+			{
+				m_Parents[node.First] = index;
+				m_Parents[node.First + 1] = index;
+				continue;
+			}
+
+			auto first = AllocateBlock(index);
+			for (std::uint32_t i = 0; i < node.Count; ++i)
+			{
+				m_Items[first + i] = packed[node.First + i];
+				m_Indices.emplace(static_cast<Entity::entity_type>(m_Items[first + i].Value), first + i);
+			}
+
+			node.First = first;
+		}
+
+		m_BuildCost = Cost();
+	}
+
+	auto SpatialIndex::Split(std::uint32_t node) -> void
+	{
+		auto first = m_Nodes[node].First;
+		auto count = m_Nodes[node].Count;
+
+		// Median splits keep the depth below the number of bits of the entity count, far below the maximum depth.
+		if (count <= LeafSize)
+			return;
+
+		auto half = Partition(std::span{m_Items}.subspan(first, count));
+
+		auto left = static_cast<std::uint32_t>(m_Nodes.size());
+		m_Nodes.push_back({Enclose(first, half), first, half});
+		m_Nodes.push_back({Enclose(first + half, count - half), first + half, count - half});
+
+		m_Nodes[node].First = left;
+		m_Nodes[node].Count = 0;
+
+		Split(left);
+		Split(left + 1);
+	}
+
+	auto SpatialIndex::SplitLeaf(std::uint32_t node, const Item& item) -> void
+	{
+		std::array<Item, LeafSize + 1> items{};
+		std::copy_n(m_Items.begin() + m_Nodes[node].First, LeafSize, items.begin());
+		items.back() = item;
+
+		auto half = Partition(items);
+		auto left = AllocatePair(node);
+
+		// The left leaf keeps the block of the split leaf.
+		std::array<std::uint32_t, 2> firsts{m_Nodes[node].First, AllocateBlock(left + 1)};
+		std::array<std::uint32_t, 2> counts{half, LeafSize + 1 - half};
+		m_Leaves[firsts[0] / LeafSize] = left;
+
+		for (std::uint32_t side = 0, offset = 0; side < 2; offset += counts[side++])
+		{
+			for (std::uint32_t i = 0; i < counts[side]; ++i)
+			{
+				m_Items[firsts[side] + i] = items[offset + i];
+				m_Indices[static_cast<Entity::entity_type>(items[offset + i].Value)] = firsts[side] + i;
+			}
+
+			m_Nodes[left + side] = {Enclose(firsts[side], counts[side]), firsts[side], counts[side]};
+		}
+
+		m_Nodes[node].First = left;
+		m_Nodes[node].Count = 0;
+	}
+
+	auto SpatialIndex::Merge(std::uint32_t node) -> void
+	{
+		m_FreeBlocks.push_back(m_Nodes[node].First / LeafSize);
+
+		auto parent = m_Parents[node];
+		if (parent == NoNode)
+		{
+			Assemble({});
+			return;
+		}
+
+		// The sibling takes the place of the parent, its children stay after it.
+		auto left = m_Nodes[parent].First;
+		auto sibling = node == left ? left + 1 : left;
+
+		m_Nodes[parent] = m_Nodes[sibling];
+		if (m_Nodes[parent].Count == 0)
+		{
+			m_Parents[m_Nodes[parent].First] = parent;
+			m_Parents[m_Nodes[parent].First + 1] = parent;
+		}
+		else
+			m_Leaves[m_Nodes[parent].First / LeafSize] = parent;
+
+		for (auto index : {left, left + 1})
+		{
+			m_Nodes[index] = {Bounds{}, NoNode, 0};
+			m_Parents[index] = NoNode;
+		}
+
+		m_FreeNodes.push_back(left);
+		RefitPath(m_Parents[parent]);
+
+		if (m_FreeNodes.size() * 4 > m_Nodes.size())
+			Rebuild();
+	}
+
+	auto SpatialIndex::RefitPath(std::uint32_t node) -> void
+	{
+		for (; node != NoNode; node = m_Parents[node])
+		{
+			auto first = m_Nodes[node].First;
+			m_Nodes[node].Box = Bounds::Merge(m_Nodes[first].Box, m_Nodes[first + 1].Box);
+		}
+	}
+
+	auto SpatialIndex::AllocatePair(std::uint32_t parent) -> std::uint32_t
+	{
+		// Only pairs after the parent keep children after their parent.
+		auto left = static_cast<std::uint32_t>(m_Nodes.size());
+		if (!m_FreeNodes.empty() && m_FreeNodes.back() > parent)
+		{
+			left = m_FreeNodes.back();
+			m_FreeNodes.pop_back();
+		}
+		else
+		{
+			m_Nodes.resize(m_Nodes.size() + 2);
+			m_Parents.resize(m_Nodes.size());
+		}
+
+		m_Parents[left] = parent;
+		m_Parents[left + 1] = parent;
+		return left;
+	}
+
+	auto SpatialIndex::AllocateBlock(std::uint32_t leaf) -> std::uint32_t
+	{
+		auto block = static_cast<std::uint32_t>(m_Leaves.size());
+		if (!m_FreeBlocks.empty())
+		{
+			block = m_FreeBlocks.back();
+			m_FreeBlocks.pop_back();
+			m_Leaves[block] = leaf;
+		}
+		else
+		{
+			m_Leaves.push_back(leaf);
+			m_Items.resize(m_Items.size() + LeafSize);
+		}
+
+		return block * LeafSize;
+	}
+
+	auto SpatialIndex::Gather() const -> std::vector<Item>
+	{
+		std::vector<Item> items{};
+		items.reserve(m_Size);
+
+		for (const auto& node : m_Nodes)
+		{
+			if (node.Count != 0)
+				items.insert(items.end(), m_Items.begin() + node.First, m_Items.begin() + node.First + node.Count);
+		}
+
+		return items;
+	}
+
+	auto SpatialIndex::Partition(std::span<Item> items) -> std::uint32_t
+	{
+		Bounds centers{glm::vec3{std::numeric_limits<float>::max()}, glm::vec3{std::numeric_limits<float>::lowest()}};
+		for (const auto& item : items)
+		{
+			auto center = item.Box.Center();
+			centers = Bounds::Merge(centers, {center, center});
+		}
+
+		auto axis = LongestAxis(centers);
+		auto half = items.size() / 2;
+
+		auto middle = items.begin() + static_cast<std::ptrdiff_t>(half);
+		std::ranges::nth_element(items, middle, [axis](const Item& lhs, const Item& rhs) {
+			return lhs.Box.Center()[axis] < rhs.Box.Center()[axis];
+		});
+
+		return static_cast<std::uint32_t>(half);
+	}
+
+	auto SpatialIndex::Enclose(std::uint32_t first, std::uint32_t count) const -> Bounds
+	{
+		auto bounds = m_Items[first].Box;
+		for (auto index = first + 1; index < first + count; ++index)
+			bounds = Bounds::Merge(bounds, m_Items[index].Box);
+
+		return bounds;
+	}
+
+	auto SpatialSystem::Initialize(EntityManager& entities) -> void
+	{
+		if (!entities.HasSingleton<SpatialIndex>())
+			entities.CreateSingleton<SpatialIndex>();
+
+		m_Created = &entities.Observe<Bounds>(ObserverEvent::Created);
+		m_Destroyed = &entities.Observe<Bounds>(ObserverEvent::Destroyed);
+	}
+
+	auto SpatialSystem::Update(EntityManager& entities) -> void
+	{
+		auto& index = entities.GetSingleton<SpatialIndex>();
+
+		if (!m_Built)
+		{
+			STAR_PROFILE_ZONE("SpatialSystem::Build");
+
+			std::vector<Entity> handles{};
+			std::vector<Bounds> bounds{};
+
+			for (auto entity : entities.View(ComponentList<const Bounds>{}, ComponentList<>{}))
+			{
+				handles.push_back(entity);
+				bounds.push_back(entities.GetComponent<Bounds>(entity));
+			}
+
+			index.Build(handles, bounds);
+			m_Created->Clear();
+			m_Destroyed->Clear();
+			m_Built = true;
+			return;
+		}
+
+		// Destroyed bounds are removed first, bounds destroyed and created again are inserted anew.
+		auto modified = !m_Created->Empty() || !m_Destroyed->Empty();
+		if (modified)
+		{
+			STAR_PROFILE_ZONE("SpatialSystem::Insert");
+
+			for (auto entity : m_Destroyed->Entities())
+				index.Remove(entity);
+
+			for (auto entity : m_Created->Entities())
+				index.Insert(entity, entities.GetComponent<Bounds>(entity));
+
+			m_Created->Clear();
+			m_Destroyed->Clear();
+		}
+
+		auto changed = false;
+		for (auto entity : entities.View(ComponentList<const Bounds, Changed<Bounds>>{}, ComponentList<>{}))
+			changed = index.Update(entity, entities.GetComponent<Bounds>(entity)) || changed;
+
+		if (changed)
+		{
+			STAR_PROFILE_ZONE("SpatialSystem::Refit");
+			index.Refit();
+		}
+
+		if ((modified || changed) && index.Cost() > index.BuildCost() * RebuildRatio)
+		{
+			STAR_PROFILE_ZONE("SpatialSystem::Rebuild");
+			index.Rebuild();
+		}
+	}
+} //namespace Star
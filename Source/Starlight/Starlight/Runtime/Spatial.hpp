@@ -0,0 +1,280 @@
+#pragma once
+
+#include "Starlight/Runtime/Entity.hpp"
+#include "Starlight/Runtime/Job.hpp"
+#include "Starlight/Runtime/System.hpp"
+
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace Star
+{
+	/// @brief Axis aligned bounding box of an entity in world space.
+	struct Bounds
+	{
+		/// @brief Minimum corner.
+		glm::vec3 Min{};
+
+		/// @brief Maximum corner.
+		glm::vec3 Max{};
+
+		/// @brief Record change ticks so the spatial index only updates moved entities.
+		static constexpr bool Tracked = true;
+
+		/// @brief Merge two bounding boxes.
+		/// @param lhs Left bounding box.
+		/// @param rhs Right bounding box.
+		/// @return Bounding box enclosing both.
+		[[nodiscard]] static auto Merge(const Bounds& lhs, const Bounds& rhs) -> Bounds;
+
+		/// @brief Get the center of the bounding box.
+		/// @return Center point.
+		[[nodiscard]] auto Center() const -> glm::vec3;
+
+		/// @brief Get the surface area of the bounding box.
+		/// @return Surface area.
+		[[nodiscard]] auto SurfaceArea() const -> float;
+
+		/// @brief Check if two bounding boxes overlap.
+		/// @param other Bounding box to check against.
+		/// @return @c true if the boxes overlap, @c false otherwise.
+		[[nodiscard]] auto Overlaps(const Bounds& other) const -> bool;
+	};
+
+	/// @brief Bounding volume hierarchy over entity bounds.
+	/// @details Nodes are stored in a flat array with the root first and the two children of an inner node stored
+	/// next to each other after their parent, so refitting is a single reverse pass over the array. Every leaf owns a
+	/// block of @c LeafSize entity slots, so entities can be inserted and removed without rebuilding the hierarchy.
+	/// Insertion descends into the child whose surface area grows least and splits full leaves, removal merges empty
+	/// leaves into their parent. Node pairs freed by removal are reused for later splits below them, the hierarchy is
+	/// rebuilt once more than half of its nodes are unused.
+	///
+	/// Queries only read the hierarchy and may run concurrently with each other, but not with modifications. Systems
+	/// querying the index published as an entity manager singleton declare it as a read component, so they are
+	/// never updated concurrently with the @c SpatialSystem writing it.
+	class SpatialIndex
+	{
+	public:
+		/// @brief Maximum number of entities per leaf.
+		static constexpr std::uint32_t LeafSize = 4;
+
+		/// @brief Node index marking unused nodes.
+		static constexpr auto NoNode = ~std::uint32_t{};
+
+		/// @brief Node of the hierarchy.
+		struct Node
+		{
+			/// @brief Bounding box enclosing all entities below the node.
+			Bounds Box{};
+
+			/// @brief Index of the first child for inner nodes, or of the first entity for leaves, @c NoNode for unused
+			/// nodes.
+			std::uint32_t First{};
+
+			/// @brief Number of entities for leaves, @c 0 for inner nodes.
+			std::uint32_t Count{};
+		};
+
+		/// @brief Rebuild the hierarchy from scratch.
+		/// @param entities Entity handles.
+		/// @param bounds Bounding boxes of the entities.
+		auto Build(std::span<const Entity> entities, std::span<const Bounds> bounds) -> void;
+
+		/// @brief Rebuild the hierarchy over the entities currently in the index.
+		auto Rebuild() -> void;
+
+		/// @brief Insert an entity into the hierarchy.
+		/// @details The bounding boxes of the nodes along the path to the receiving leaf are enlarged.
+		/// @param entity Entity handle.
+		/// @param bounds Bounding box of the entity.
+		/// @return @c true if the entity was inserted, @c false if it already is in the index.
+		auto Insert(Entity entity, const Bounds& bounds) -> bool;
+
+		/// @brief Remove an entity from the hierarchy.
+		/// @details The bounding boxes of the nodes along the path to its leaf are shrunk.
+		/// @param entity Entity handle.
+		/// @return @c true if the entity was removed, @c false if it is not in the index.
+		auto Remove(Entity entity) -> bool;
+
+		/// @brief Update the bounding box of an entity without updating the hierarchy.
+		/// @param entity Entity handle.
+		/// @param bounds New bounding box.
+		/// @return @c true if the entity is in the index and its bounding box changed, @c false otherwise.
+		auto Update(Entity entity, const Bounds& bounds) -> bool;
+
+		/// @brief Recompute the bounding boxes of all nodes bottom up, keeping the hierarchy.
+		auto Refit() -> void;
+
+		/// @brief Get the cost of the hierarchy.
+		/// @details Sum of the surface areas of all inner nodes, proportional to the expected number of nodes visited
+		/// by a query. It grows as refitting loosens the hierarchy around moving entities.
+		/// @return Traversal cost estimate.
+		[[nodiscard]] auto Cost() const -> float;
+
+		/// @brief Get the cost of the hierarchy when it was last built.
+		/// @return Traversal cost estimate.
+		[[nodiscard]] auto BuildCost() const -> float;
+
+		/// @brief Get the number of entities in the index.
+		/// @return Number of entities.
+		[[nodiscard]] auto Size() const -> std::size_t;
+
+		/// @brief Get the nodes of the hierarchy.
+		/// @return Nodes with the root first and children after their parent, including unused nodes.
+		[[nodiscard]] auto Nodes() const -> std::span<const Node>;
+
+		/// @brief Invoke a function for every entity whose bounding box passes a test.
+		/// @details Subtrees whose bounding box does not pass the test are skipped.
+		/// @tparam TTest Test function type.
+		/// @tparam TFunction Function type.
+		/// @param test Function checking a bounding box.
+		/// @param function Function invoked with each entity passing the test.
+		template <std::predicate<const Bounds&> TTest, std::invocable<Entity> TFunction>
+		auto Query(TTest test, TFunction function) const -> void
+		{
+			if (m_Nodes.empty())
+				return;
+
+			// Insertion rebuilds the hierarchy instead of splitting leaves at the maximum depth, bounding the stack.
+			std::array<std::uint32_t, MaxDepth> stack{};
+			std::size_t size{};
+			stack[size++] = 0;
+
+			while (size > 0)
+			{
+				const auto& node = m_Nodes[stack[--size]];
+				if (!test(node.Box))
+					continue;
+
+				if (node.Count == 0)
+				{
+					stack[size++] = node.First;
+					stack[size++] = node.First + 1;
+					continue;
+				}
+
+				for (auto index = node.First; index < node.First + node.Count; ++index)
+				{
+					if (test(m_Items[index].Box))
+						function(m_Items[index].Value);
+				}
+			}
+		}
+
+		/// @brief Collect entities whose bounding box overlaps a bounding box.
+		/// @param bounds Bounding box to check against.
+		/// @param result Vector the entities are appended to.
+		auto Overlap(const Bounds& bounds, std::vector<Entity>& result) const -> void;
+
+		/// @brief Collect entities whose bounding box overlaps a sphere.
+		/// @param center Center of the sphere.
+		/// @param radius Radius of the sphere.
+		/// @param result Vector the entities are appended to.
+		auto Sphere(glm::vec3 center, float radius, std::vector<Entity>& result) const -> void;
+
+		/// @brief Collect entities whose bounding box is hit by a ray.
+		/// @param origin Origin of the ray.
+		/// @param direction Direction of the ray.
+		/// @param distance Maximum distance along the ray, in multiples of @p direction.
+		/// @param result Vector the entities are appended to.
+		auto Ray(glm::vec3 origin, glm::vec3 direction, float distance, std::vector<Entity>& result) const -> void;
+
+		/// @brief Collect entities whose bounding box intersects a frustum.
+		/// @param planes Frustum planes with normals pointing inwards, as @c xyz and distance as @c w.
+		/// @param result Vector the entities are appended to.
+		auto Frustum(std::span<const glm::vec4, 6> planes, std::vector<Entity>& result) const -> void;
+
+		/// @brief Run a batch of overlap queries on worker threads.
+		/// @tparam TFunction Function type.
+		/// @param jobs Job system to execute on.
+		/// @param queries Bounding boxes to check against.
+		/// @param function Function invoked concurrently with the query index and each overlapping entity.
+		template <std::invocable<std::size_t, Entity> TFunction>
+		auto ParallelOverlap(JobSystem& jobs, std::span<const Bounds> queries, TFunction function) const -> void
+		{
+			jobs.ParallelFor(queries.size(), [&](std::size_t query) {
+				Query(
+					[&](const Bounds& bounds) { return bounds.Overlaps(queries[query]); },
+					[&](Entity entity) { function(query, entity); }
+				);
+			});
+		}
+
+	private:
+		static constexpr std::size_t MaxDepth = 64;
+
+		struct Item
+		{
+			Bounds Box{};
+			Entity Value{};
+		};
+
+		auto Assemble(std::vector<Item> items) -> void;
+
+		auto Split(std::uint32_t node) -> void;
+
+		auto SplitLeaf(std::uint32_t node, const Item& item) -> void;
+
+		auto Merge(std::uint32_t node) -> void;
+
+		auto RefitPath(std::uint32_t node) -> void;
+
+		[[nodiscard]] auto AllocatePair(std::uint32_t parent) -> std::uint32_t;
+
+		[[nodiscard]] auto AllocateBlock(std::uint32_t leaf) -> std::uint32_t;
+
+		[[nodiscard]] auto Gather() const -> std::vector<Item>;
+
+		[[nodiscard]] static auto Partition(std::span<Item> items) -> std::uint32_t;
+
+		[[nodiscard]] auto Enclose(std::uint32_t first, std::uint32_t count) const -> Bounds;
+
+		std::vector<Node> m_Nodes{};
+		std::vector<std::uint32_t> m_Parents{};
+		std::vector<Item> m_Items{};
+		std::vector<std::uint32_t> m_Leaves{};
+		std::vector<std::uint32_t> m_FreeNodes{};
+		std::vector<std::uint32_t> m_FreeBlocks{};
+		std::unordered_map<Entity::entity_type, std::uint32_t> m_Indices{};
+		std::size_t m_Size{};
+		float m_BuildCost{};
+	};
+
+	/// @brief System keeping the @c SpatialIndex singleton in sync with entity bounds.
+	/// @details Entities whose bounds are destroyed are removed from the hierarchy and entities whose bounds are
+	/// created are inserted into it. The bounds that changed since the system last ran are updated and the hierarchy
+	/// is refitted. The hierarchy is only rebuilt when its cost exceeds the cost at the time it was built by
+	/// @c RebuildRatio.
+	class SpatialSystem : public System
+	{
+	public:
+		/// @brief Update in the root of the system manager.
+		using UpdateIn = SystemManager;
+
+		/// @brief Components read by the system.
+		using Reads = ComponentList<Bounds>;
+
+		/// @brief Components written by the system.
+		using Writes = ComponentList<SpatialIndex>;
+
+		/// @brief Cost growth relative to the last build at which refitting gives way to rebuilding.
+		static constexpr float RebuildRatio = 1.5F;
+
+		auto Initialize(EntityManager& entities) -> void override;
+
+		auto Update(EntityManager& entities) -> void override;
+
+	private:
+		EntityObserver* m_Created{};
+		EntityObserver* m_Destroyed{};
+		bool m_Built{};
+	};
+} //namespace Star
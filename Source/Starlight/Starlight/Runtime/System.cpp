@@ -1,26 +1,340 @@
 #include "System.hpp"
 
+#include "Starlight/Runtime/Command.hpp"
+#include "Starlight/Runtime/Job.hpp"
+#include "Starlight/Runtime/Profiler.hpp"
+
 #include <algorithm>
-#include <ranges>
-#include <vector>
+#include <optional>
+#include <string>
+
+namespace
+{
+	using namespace Star;
+
+	[[nodiscard]] auto Contains(std::span<const entt::id_type> types, entt::id_type type) -> bool
+	{
+		return std::ranges::find(types, type) != types.end();
+	}
+
+	[[nodiscard]] auto Overlaps(std::span<const entt::id_type> lhs, std::span<const entt::id_type> rhs) -> bool
+	{
+		return std::ranges::any_of(lhs, [&](entt::id_type type) { return Contains(rhs, type); });
+	}
+
+	/// Kahn's algorithm, picking the lowest type hash among ready systems to keep the order deterministic.
+	[[nodiscard]] auto Sort(std::span<const SystemKey> keys) -> std::vector<std::size_t>
+	{
+		std::vector<std::size_t> pending(keys.size());
+		for (std::size_t i = 0; i < keys.size(); ++i)
+		{
+			for (std::size_t j = 0; j < keys.size(); ++j)
+			{
+				if (i != j && Precedes(keys[i], keys[j]))
+					++pending[j];
+			}
+		}
+
+		std::vector<std::size_t> order{};
+		order.reserve(keys.size());
+
+		std::vector<bool> sorted(keys.size());
+		while (order.size() < keys.size())
+		{
+			std::optional<std::size_t> next{};
+			for (std::size_t i = 0; i < keys.size(); ++i)
+			{
+				if (!sorted[i] && pending[i] == 0 && (!next || keys[i].Type < keys[*next].Type))
+					next = i;
+			}
+
+			if (!next)
+				throw SystemException{"System ordering constraints contain a cycle"};
+
+			sorted[*next] = true;
+			order.push_back(*next);
+
+			for (std::size_t j = 0; j < keys.size(); ++j)
+			{
+				if (!sorted[j] && j != *next && Precedes(keys[*next], keys[j]))
+					--pending[j];
+			}
+		}
+
+		return order;
+	}
+} //namespace
 
 namespace Star
 {
-	auto operator<(const SystemKey& lhs, const SystemKey& rhs) -> bool
+	auto System::Initialize([[maybe_unused]] EntityManager& entities) -> void
 	{
-		if (std::ranges::any_of(lhs.Precedes, [&](entt::id_type type) { return type == rhs.Type; }))
-			return true;
+	}
+
+	auto Precedes(const SystemKey& lhs, const SystemKey& rhs) -> bool
+	{
+		return Contains(lhs.Precedes, rhs.Type) || Contains(rhs.Succeeds, lhs.Type);
+	}
 
-		if (std::ranges::any_of(rhs.Succeeds, [&](entt::id_type type) { return type == lhs.Type; }))
+	auto Conflicts(const SystemKey& lhs, const SystemKey& rhs) -> bool
+	{
+		if (lhs.Exclusive || rhs.Exclusive)
 			return true;
 
-		return lhs.Type < rhs.Type;
+		return Overlaps(lhs.Writes, rhs.Writes) || Overlaps(lhs.Writes, rhs.Reads) || Overlaps(lhs.Reads, rhs.Writes);
 	}
 
 	auto SystemGroup::Update(EntityManager& entities) -> void
 	{
-		auto values = std::views::values(m_Systems);
-		for (const auto& system : std::vector(values.begin(), values.end()))
-			system->Update(entities);
+		if (!m_Compiled)
+			Compile(entities);
+
+		if (!m_Timestep || !entities.HasSingleton<Time>())
+		{
+			Dispatch(entities);
+			return;
+		}
+
+		auto& time = entities.GetSingleton<Time>();
+		auto delta = time.Delta;
+		auto steps = m_Timestep->Advance(time.FrameDelta);
+
+		time.Delta = m_Timestep->Step();
+		for (std::uint32_t step = 0; step < steps; ++step)
+			Dispatch(entities);
+
+		time.Delta = delta;
+		time.Alphas[m_Type] = m_Timestep->Alpha();
+	}
+
+	auto SystemGroup::Insert(const SystemKey& key, std::unique_ptr<System> system, SystemGroup* group) -> void
+	{
+		std::vector<SystemKey> keys{};
+		keys.reserve(m_Systems.size() + 1);
+
+		for (const auto& entry : m_Systems)
+		{
+			if (entry.Key.Type != key.Type)
+				keys.push_back(entry.Key);
+		}
+
+		keys.push_back(key);
+
+		auto order = Sort(keys);
+
+		std::vector<Entry> entries{};
+		entries.reserve(keys.size());
+
+		std::erase_if(m_Systems, [&](const Entry& entry) { return entry.Key.Type == key.Type; });
+		m_Systems.push_back(Entry{
+			.Key = key,
+			.Instance = std::move(system),
+			.Group = group,
+		});
+
+		for (auto index : order)
+			entries.push_back(std::move(m_Systems[index]));
+
+		m_Systems = std::move(entries);
+
+		if (group != nullptr)
+		{
+			group->m_Parent = this;
+
+			if (key.TickRate > 0)
+			{
+				group->m_Type = key.Type;
+				group->m_Timestep.emplace(key.TickRate);
+			}
+		}
+
+		Invalidate();
+	}
+
+	auto SystemGroup::Erase(entt::id_type type) -> bool
+	{
+		if (std::erase_if(m_Systems, [&](const Entry& entry) { return entry.Key.Type == type; }) == 0)
+			return false;
+
+		Invalidate();
+		return true;
+	}
+
+	auto SystemGroup::Find(entt::id_type type) const -> System*
+	{
+		auto entry = std::ranges::find(m_Systems, type, [](const Entry& entry) { return entry.Key.Type; });
+		return entry != m_Systems.end() ? entry->Instance.get() : nullptr;
+	}
+
+	auto SystemGroup::At(entt::id_type type) const -> System&
+	{
+		if (auto* system = Find(type))
+			return *system;
+
+		throw std::out_of_range{"System does not exist"};
+	}
+
+	auto SystemGroup::Invalidate() -> void
+	{
+		for (auto* group = this; group != nullptr; group = group->m_Parent)
+			group->m_Compiled = false;
+	}
+
+	auto SystemGroup::Compile(EntityManager& entities) -> void
+	{
+		struct Leaf
+		{
+			Entry* Source{};
+			std::vector<const SystemKey*> Path{};
+		};
+
+		std::vector<Leaf> leaves{};
+		std::vector<const SystemKey*> path{};
+
+		// Fixed rate groups compile their own plan, so their zone names are prefixed with the path leading to them.
+		std::vector<const SystemKey*> prefix{};
+		for (const auto* group = this; group->m_Parent != nullptr; group = group->m_Parent)
+		{
+			auto entry = std::ranges::find(group->m_Parent->m_Systems, group, &Entry::Group);
+			prefix.insert(prefix.begin(), &entry->Key);
+		}
+
+		auto flatten = [&](auto& self, SystemGroup& group) -> void {
+			for (auto& entry : group.m_Systems)
+			{
+				path.push_back(&entry.Key);
+
+				if (entry.Group != nullptr && !entry.Group->m_Timestep)
+					self(self, *entry.Group);
+				else
+					leaves.push_back(Leaf{.Source = &entry, .Path = path});
+
+				path.pop_back();
+			}
+		};
+
+		flatten(flatten, *this);
+
+		// Storages are created after all initializations, so singletons created by any subsystem are skipped.
+		for (auto& leaf : leaves)
+		{
+			if (leaf.Source->Initialized)
+				continue;
+
+			leaf.Source->Instance->Initialize(entities);
+			leaf.Source->Initialized = true;
+		}
+
+		for (const auto& leaf : leaves)
+		{
+			if (leaf.Source->Key.CreateStorages != nullptr)
+				leaf.Source->Key.CreateStorages(entities);
+		}
+
+		// Two leaves are ordered by the constraints between their ancestors directly below the deepest group they
+		// share, and by the components they access themselves.
+		auto ordered = [](const Leaf& lhs, const Leaf& rhs) {
+			auto [lhsKey, rhsKey] = std::ranges::mismatch(lhs.Path, rhs.Path);
+			if (lhsKey != lhs.Path.end() && rhsKey != rhs.Path.end() && Precedes(**lhsKey, **rhsKey))
+				return true;
+
+			return Conflicts(*lhs.Path.back(), *rhs.Path.back());
+		};
+
+		// Every leaf is placed one stage after the latest earlier leaf it is ordered after, so leaves sharing a
+		// stage are independent of each other and the topological order is kept between all dependent leaves.
+		std::vector<std::size_t> levels(leaves.size());
+		std::size_t levelCount{};
+
+		for (std::size_t j = 0; j < leaves.size(); ++j)
+		{
+			for (std::size_t i = 0; i < j; ++i)
+			{
+				if (levels[i] >= levels[j] && ordered(leaves[i], leaves[j]))
+					levels[j] = levels[i] + 1;
+			}
+
+			levelCount = std::max(levelCount, levels[j] + 1);
+		}
+
+		auto name = [&](const Leaf& leaf) {
+			std::string result{};
+			for (const auto* key : prefix)
+				result.append(key->Name).append("/");
+
+			for (const auto* key : leaf.Path)
+				result.append(key->Name).append("/");
+
+			result.pop_back();
+			return Profiler::Intern(result);
+		};
+
+		m_Plan.clear();
+		m_Plan.reserve(leaves.size());
+		m_Names.clear();
+		m_Names.reserve(leaves.size());
+		m_LastRuns.clear();
+		m_LastRuns.reserve(leaves.size());
+		m_Stages.clear();
+		m_Stages.reserve(levelCount + 1);
+
+		for (std::size_t level = 0; level < levelCount; ++level)
+		{
+			m_Stages.push_back(m_Plan.size());
+
+			for (std::size_t i = 0; i < leaves.size(); ++i)
+			{
+				if (levels[i] != level)
+					continue;
+
+				m_Plan.push_back(leaves[i].Source->Instance.get());
+				m_Names.push_back(name(leaves[i]));
+				m_LastRuns.push_back(&leaves[i].Source->LastRun);
+			}
+		}
+
+		m_Stages.push_back(m_Plan.size());
+		m_Compiled = true;
+	}
+
+	auto SystemGroup::Dispatch(EntityManager& entities) -> void
+	{
+		auto* jobs = entities.HasSingleton<JobSystem*>() ? entities.GetSingleton<JobSystem*>() : nullptr;
+		auto* commands = entities.HasSingleton<CommandQueue>() ? &entities.GetSingleton<CommandQueue>() : nullptr;
+
+		for (std::size_t stage = 0; stage + 1 < m_Stages.size(); ++stage)
+		{
+			auto offset = m_Stages[stage];
+			auto count = m_Stages[stage + 1] - offset;
+			auto tick = entities.AdvanceChangeTick();
+
+			auto update = [&, offset, tick](std::size_t index) {
+				STAR_PROFILE_ZONE(m_Names[offset + index]);
+
+				auto& lastRun = *m_LastRuns[offset + index];
+				auto previous = EntityManager::LastRunTick();
+
+				EntityManager::LastRunTick(lastRun);
+				m_Plan[offset + index]->Update(entities);
+				EntityManager::LastRunTick(previous);
+
+				lastRun = tick;
+			};
+
+			if (jobs == nullptr || count == 1)
+			{
+				for (std::size_t index = 0; index < count; ++index)
+					update(index);
+			}
+			else
+			{
+				jobs->ParallelFor(count, update);
+			}
+
+			entities.AdvanceChangeTick();
+
+			if (commands != nullptr && !commands->Empty())
+				commands->Playback(entities);
+		}
 	}
 } //namespace Star
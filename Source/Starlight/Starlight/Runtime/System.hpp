@@ -1,12 +1,19 @@
 #pragma once
 
 #include "Starlight/Runtime/Entity.hpp"
+#include "Starlight/Runtime/Time.hpp"
+
+#include <entt/core/type_info.hpp>
 
 #include <array>
 #include <concepts>
-#include <map>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <span>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
 
 namespace Star
 {
@@ -17,6 +24,13 @@ namespace Star
 		/// @brief Destructor.
 		virtual ~System() = default;
 
+		/// @brief Prepare the system before its first update.
+		/// @details Called once on the updating thread before the system is first updated, while no other system
+		/// updates. Systems create the singletons and observers they need here, as inserting them into the entity
+		/// manager during a concurrent update would race with other systems.
+		/// @param entities Entities on which the system will operate.
+		virtual auto Initialize(EntityManager& entities) -> void;
+
 		/// @brief Update the system.
 		/// @param entities Entities on which the system should operate.
 		virtual auto Update(EntityManager& entities) -> void = 0;
@@ -86,18 +100,135 @@ namespace Star
 		static_assert(IsSystemList<typename TType::Succeed>{});
 	};
 
+	/// @brief A list of components this system reads.
+	/// @tparam TType System type.
+	template <std::derived_from<System> TType>
+	struct SystemTraitReads
+	{
+		/// @brief Whether the system declares the components it reads.
+		static constexpr auto Declared = false;
+
+		/// @brief Component type indices.
+		static constexpr auto Hashes = std::array<entt::id_type, 0>{};
+
+		/// @brief Create the storages of the components.
+		/// @param entities Entity manager to create the storages in.
+		static auto CreateStorages([[maybe_unused]] EntityManager& entities) -> void
+		{
+		}
+	};
+
+	/// @brief A list of components this system reads.
+	/// @tparam TType System type.
+	template <std::derived_from<System> TType>
+	requires requires { typename TType::Reads; }
+	struct SystemTraitReads<TType>
+	{
+		/// @brief Whether the system declares the components it reads.
+		static constexpr auto Declared = true;
+
+		/// @brief Component type indices.
+		static constexpr auto Hashes = TType::Reads::Hashes;
+		static_assert(IsComponentList<typename TType::Reads>{});
+
+		/// @brief Create the storages of the components.
+		/// @param entities Entity manager to create the storages in.
+		static auto CreateStorages(EntityManager& entities) -> void
+		{
+			entities.CreateStorages(typename TType::Reads{});
+		}
+	};
+
+	/// @brief A list of components this system writes.
+	/// @tparam TType System type.
+	template <std::derived_from<System> TType>
+	struct SystemTraitWrites
+	{
+		/// @brief Whether the system declares the components it writes.
+		static constexpr auto Declared = false;
+
+		/// @brief Component type indices.
+		static constexpr auto Hashes = std::array<entt::id_type, 0>{};
+
+		/// @brief Create the storages of the components.
+		/// @param entities Entity manager to create the storages in.
+		static auto CreateStorages([[maybe_unused]] EntityManager& entities) -> void
+		{
+		}
+	};
+
+	/// @brief A list of components this system writes.
+	/// @tparam TType System type.
+	template <std::derived_from<System> TType>
+	requires requires { typename TType::Writes; }
+	struct SystemTraitWrites<TType>
+	{
+		/// @brief Whether the system declares the components it writes.
+		static constexpr auto Declared = true;
+
+		/// @brief Component type indices.
+		static constexpr auto Hashes = TType::Writes::Hashes;
+		static_assert(IsComponentList<typename TType::Writes>{});
+
+		/// @brief Create the storages of the components.
+		/// @param entities Entity manager to create the storages in.
+		static auto CreateStorages(EntityManager& entities) -> void
+		{
+			entities.CreateStorages(typename TType::Writes{});
+		}
+	};
+
+	/// @brief Frequency at which a system group updates its subsystems.
+	/// @tparam TType System type.
+	template <std::derived_from<System> TType>
+	struct SystemTraitTickRate
+	{
+		/// @brief Updates per second, @c 0 to update once per frame.
+		static constexpr double Value = 0;
+	};
+
+	/// @brief Frequency at which a system group updates its subsystems.
+	/// @tparam TType System type.
+	template <std::derived_from<System> TType>
+	requires requires { TType::TickRate; }
+	struct SystemTraitTickRate<TType>
+	{
+		/// @brief Updates per second, @c 0 to update once per frame.
+		static constexpr double Value = TType::TickRate;
+		static_assert(Value > 0);
+	};
+
 	/// @brief Key to organize and identify system order.
 	struct SystemKey
 	{
 		/// @brief System type hash.
 		entt::id_type Type{};
 
+		/// @brief System type name, used to name profiling zones.
+		std::string_view Name{};
+
 		/// @brief Type hashes for systems this system should update before.
 		std::span<const entt::id_type> Precedes{};
 
 		/// @brief Type hashes for systems this system should update after.
 		std::span<const entt::id_type> Succeeds{};
 
+		/// @brief Type hashes for components this system reads.
+		std::span<const entt::id_type> Reads{};
+
+		/// @brief Type hashes for components this system writes.
+		std::span<const entt::id_type> Writes{};
+
+		/// @brief Whether the system must not run concurrently with any other system.
+		/// @details Fixed rate system groups are always exclusive, as they modify the @c Time singleton.
+		bool Exclusive{};
+
+		/// @brief Updates per second of the subsystems of a system group, @c 0 to update once per frame.
+		double TickRate{};
+
+		/// @brief Function creating the storages of the components this system reads and writes.
+		void (*CreateStorages)(EntityManager&){};
+
 		/// @brief Create a system key for a specific type.
 		/// @tparam TType System type.
 		/// @return System key for the specified system type.
@@ -106,19 +237,61 @@ namespace Star
 		{
 			return SystemKey{
 				.Type = entt::type_hash<TType>::value(),
+				.Name = entt::type_name<TType>::value(),
 				.Precedes = SystemTraitPrecedes<TType>::Hashes,
 				.Succeeds = SystemTraitSucceeds<TType>::Hashes,
+				.Reads = SystemTraitReads<TType>::Hashes,
+				.Writes = SystemTraitWrites<TType>::Hashes,
+				.Exclusive = (!SystemTraitReads<TType>::Declared && !SystemTraitWrites<TType>::Declared) ||
+							 SystemTraitTickRate<TType>::Value > 0,
+				.TickRate = SystemTraitTickRate<TType>::Value,
+				.CreateStorages =
+					[](EntityManager& entities) {
+						SystemTraitReads<TType>::CreateStorages(entities);
+						SystemTraitWrites<TType>::CreateStorages(entities);
+					},
 			};
 		}
 	};
 
-	/// @brief Check if a system key is before another system key.
+	/// @brief Check if a system has to be updated before another system.
 	/// @param lhs Left hand side system key.
 	/// @param rhs Right hand side system key.
-	/// @return @c true if @c lhs should sort before @c rhs, @c false otherwise.
-	[[nodiscard]] auto operator<(const SystemKey& lhs, const SystemKey& rhs) -> bool;
+	/// @return @c true if @c lhs precedes @c rhs or @c rhs succeeds @c lhs, @c false otherwise.
+	[[nodiscard]] auto Precedes(const SystemKey& lhs, const SystemKey& rhs) -> bool;
 
-	/// @brief A system with an ordered map of nested subsystems.
+	/// @brief Check if two systems access conflicting components.
+	/// @param lhs Left hand side system key.
+	/// @param rhs Right hand side system key.
+	/// @return @c true if the systems must not be updated concurrently, @c false otherwise.
+	[[nodiscard]] auto Conflicts(const SystemKey& lhs, const SystemKey& rhs) -> bool;
+
+	/// @brief Exception raised when a system specific error happens.
+	struct SystemException : std::runtime_error
+	{
+		using runtime_error::runtime_error;
+	};
+
+	/// @brief A system with a topologically ordered list of nested subsystems.
+	/// @details Updating a group dispatches an execution plan compiled whenever the group or one of its nested
+	/// groups changes. Nested groups are flattened into the plan, and subsystems that do not conflict with each
+	/// other are updated concurrently on the job system published in the entity manager. Subsystems that declare
+	/// neither reads nor writes are updated alone.
+	///
+	/// Groups declaring a @c TickRate are not flattened into their parent. They are updated alone and run their own
+	/// plan as many fixed steps as the frame duration in the @c Time singleton accumulates, with @c Time::Delta set to
+	/// the step duration. The remaining interpolation factor is stored in @c Time::Alphas under the type of the group.
+	///
+	/// Compiling the plan initializes subsystems added since the previous compilation and creates the storages of
+	/// the components all subsystems declare, so nothing is inserted into the entity manager while subsystems update
+	/// concurrently. Subsystems must not access components they do not declare.
+	///
+	/// Structural changes recorded into the @c CommandQueue singleton are played back after every stage.
+	///
+	/// The change tick of the entity manager is advanced before and after every stage. Every subsystem remembers
+	/// the tick of the stage it last ran in, which change filters of the views it creates compare against.
+	///
+	/// Every subsystem update is recorded as a profiling zone named after the path of system types leading to it.
 	class SystemGroup : public System
 	{
 	public:
@@ -129,12 +302,19 @@ namespace Star
 		/// @tparam TArgs System constructor argument types.
 		/// @param args System constructor arguments.
 		/// @return A reference to the system.
+		/// @throws SystemException If the system would introduce an ordering cycle.
 		template <std::derived_from<System> TType, typename... TArgs>
 		auto CreateSystem(TArgs&&... args) -> TType&
 		{
-			auto system = std::make_shared<TType>(std::forward<TArgs>(args)...);
-			m_Systems.insert_or_assign(SystemKey::Value<TType>(), system);
-			return *system;
+			auto system = std::make_unique<TType>(std::forward<TArgs>(args)...);
+			auto& result = *system;
+
+			SystemGroup* group{};
+			if constexpr (std::derived_from<TType, SystemGroup>)
+				group = &result;
+
+			Insert(SystemKey::Value<TType>(), std::move(system), group);
+			return result;
 		}
 
 		/// @brief Destroy a system.
@@ -143,7 +323,7 @@ namespace Star
 		template <std::derived_from<System> TType>
 		auto DestroySystem() -> bool
 		{
-			return m_Systems.erase(SystemKey::Value<TType>()) > 0;
+			return Erase(entt::type_hash<TType>::value());
 		}
 
 		/// @brief Check if a system exists.
@@ -152,7 +332,7 @@ namespace Star
 		template <std::derived_from<System> TType>
 		[[nodiscard]] auto HasSystem() const -> bool
 		{
-			return m_Systems.contains(SystemKey::Value<TType>());
+			return Find(entt::type_hash<TType>::value()) != nullptr;
 		}
 
 		/// @brief Get a system.
@@ -161,7 +341,7 @@ namespace Star
 		template <std::derived_from<System> TType>
 		[[nodiscard]] auto GetSystem() -> TType&
 		{
-			return static_cast<TType&>(*m_Systems.at(SystemKey::Value<TType>()));
+			return static_cast<TType&>(At(entt::type_hash<TType>::value()));
 		}
 
 		/// @brief Get a system.
@@ -170,11 +350,43 @@ namespace Star
 		template <std::derived_from<System> TType>
 		[[nodiscard]] auto GetSystem() const -> const TType&
 		{
-			return static_cast<const TType&>(*m_Systems.at(SystemKey::Value<TType>()));
+			return static_cast<const TType&>(At(entt::type_hash<TType>::value()));
 		}
 
 	private:
-		std::map<SystemKey, std::shared_ptr<System>> m_Systems{};
+		struct Entry
+		{
+			SystemKey Key{};
+			std::unique_ptr<System> Instance{};
+			SystemGroup* Group{};
+			std::uint64_t LastRun{};
+			bool Initialized{};
+		};
+
+		auto Insert(const SystemKey& key, std::unique_ptr<System> system, SystemGroup* group) -> void;
+
+		auto Erase(entt::id_type type) -> bool;
+
+		[[nodiscard]] auto Find(entt::id_type type) const -> System*;
+
+		[[nodiscard]] auto At(entt::id_type type) const -> System&;
+
+		auto Invalidate() -> void;
+
+		auto Compile(EntityManager& entities) -> void;
+
+		auto Dispatch(EntityManager& entities) -> void;
+
+		std::vector<Entry> m_Systems{};
+		SystemGroup* m_Parent{};
+		entt::id_type m_Type{};
+		std::optional<FixedTimestep> m_Timestep{};
+
+		std::vector<System*> m_Plan{};
+		std::vector<const char*> m_Names{};
+		std::vector<std::uint64_t*> m_LastRuns{};
+		std::vector<std::size_t> m_Stages{};
+		bool m_Compiled{};
 	};
 
 	/// @brief Type of system group this system should update in.
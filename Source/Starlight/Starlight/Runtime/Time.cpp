@@ -0,0 +1,36 @@
+#include "Time.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Star
+{
+	FixedTimestep::FixedTimestep(double rate, std::uint32_t maxSteps) :
+		m_Step{1.0 / rate},
+		m_MaxSteps{std::max<std::uint32_t>(maxSteps, 1)}
+	{
+	}
+
+	auto FixedTimestep::Advance(double delta) -> std::uint32_t
+	{
+		m_Accumulator += std::max(delta, 0.0);
+
+		auto steps = std::floor(m_Accumulator / m_Step);
+		m_Accumulator -= steps * m_Step;
+
+		if (steps <= m_MaxSteps)
+			return static_cast<std::uint32_t>(steps);
+
+		return m_MaxSteps;
+	}
+
+	auto FixedTimestep::Step() const -> double
+	{
+		return m_Step;
+	}
+
+	auto FixedTimestep::Alpha() const -> double
+	{
+		return std::clamp(m_Accumulator / m_Step, 0.0, 1.0);
+	}
+} //namespace Star
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <entt/core/type_info.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+
+namespace Star
+{
+	/// @brief Timing of the current update, available as an entity manager singleton.
+	struct Time
+	{
+		/// @brief Duration in seconds of the step currently being updated.
+		/// @details Equals @c FrameDelta, except while a fixed rate system group is updating its subsystems.
+		double Delta{};
+
+		/// @brief Duration in seconds of the current frame, clamped to @c MaxFrameDelta.
+		double FrameDelta{};
+
+		/// @brief Total duration in seconds of all frames.
+		double Elapsed{};
+
+		/// @brief Interpolation factors between the two latest steps of the updated fixed rate system groups.
+		/// @details Keyed by the type of the group, every group has its own accumulator.
+		std::unordered_map<entt::id_type, double> Alphas{};
+
+		/// @brief Number of frames updated before the current frame.
+		std::uint64_t Frame{};
+
+		/// @brief Upper limit for the frame duration, preventing fixed rate groups from spiralling after stalls.
+		static constexpr double MaxFrameDelta = 0.25;
+
+		/// @brief Get the interpolation factor of a fixed rate system group.
+		/// @tparam TGroup System group type.
+		/// @return Interpolation factor between the two latest steps of the group, @c 0 if it was not updated yet.
+		template <typename TGroup>
+		[[nodiscard]] auto Alpha() const -> double
+		{
+			auto found = Alphas.find(entt::type_hash<TGroup>::value());
+			return found != Alphas.end() ? found->second : 0.0;
+		}
+	};
+
+	/// @brief Accumulator turning variable frame durations into a number of fixed steps.
+	class FixedTimestep
+	{
+	public:
+		/// @brief Default maximum number of steps per frame.
+		static constexpr std::uint32_t DefaultMaxSteps = 8;
+
+		/// @brief Create a fixed timestep.
+		/// @param rate Number of steps per second.
+		/// @param maxSteps Maximum number of steps per frame, surplus time is dropped.
+		explicit FixedTimestep(double rate, std::uint32_t maxSteps = DefaultMaxSteps);
+
+		/// @brief Accumulate the duration of a frame.
+		/// @param delta Frame duration in seconds.
+		/// @return Number of steps to update this frame.
+		[[nodiscard]] auto Advance(double delta) -> std::uint32_t;
+
+		/// @brief Get the duration of a single step.
+		/// @return Step duration in seconds.
+		[[nodiscard]] auto Step() const -> double;
+
+		/// @brief Get the interpolation factor between the two latest steps.
+		/// @return Fraction of a step accumulated but not yet updated, in <tt>[0, 1)</tt>.
+		[[nodiscard]] auto Alpha() const -> double;
+
+	private:
+		double m_Step{};
+		double m_Accumulator{};
+		std::uint32_t m_MaxSteps{};
+	};
+} //namespace Star
@@ -0,0 +1,336 @@
+#include "Transform.hpp"
+
+#include "Starlight/Runtime/Job.hpp"
+#include "Starlight/Runtime/Profiler.hpp"
+
+#include <algorithm>
+
+namespace Star
+{
+	auto LocalTransform::Matrix() const -> glm::mat4
+	{
+		auto matrix = glm::mat4_cast(Rotation);
+		matrix[0] *= Scale.x;
+		matrix[1] *= Scale.y;
+		matrix[2] *= Scale.z;
+		matrix[3] = glm::vec4{Position, 1.0F};
+		return matrix;
+	}
+
+	auto TransformSystem::Initialize(EntityManager& entities) -> void
+	{
+		// Changes that move entities between layers or require their world transform to be created.
+		m_Observers = {
+			&entities.Observe<LocalTransform>(ObserverEvent::Created),
+			&entities.Observe<LocalTransform>(ObserverEvent::Destroyed),
+			&entities.Observe<Parent>(ObserverEvent::Created),
+			&entities.Observe<Parent>(ObserverEvent::Replaced),
+			&entities.Observe<Parent>(ObserverEvent::Destroyed),
+			&entities.Observe<WorldTransform>(ObserverEvent::Destroyed),
+		};
+	}
+
+	auto TransformSystem::Update(EntityManager& entities) -> void
+	{
+		// Created local transforms may be parents of orphans, destroyed components move others in their storage.
+		auto lastRun = EntityManager::LastRunTick();
+		auto created = !m_Observers[0]->Empty();
+		auto refresh = !m_Observers[1]->Empty() || !m_Observers[5]->Empty();
+
+		if (!m_Built)
+		{
+			for (auto entity : entities.View(ComponentList<const LocalTransform>{}, ComponentList<>{}))
+				m_Touched.push_back(entity);
+
+			m_Built = true;
+		}
+
+		for (auto* observer : m_Observers)
+		{
+			auto changed = observer->Entities();
+			m_Touched.insert(m_Touched.end(), changed.begin(), changed.end());
+			observer->Clear();
+		}
+
+		if (created && !m_Orphans.empty())
+			Adopt(entities);
+
+		if (!m_Touched.empty())
+		{
+			STAR_PROFILE_ZONE("TransformSystem::Restructure");
+			Restructure(entities);
+		}
+
+		auto* jobs = entities.HasSingleton<JobSystem*>() ? entities.GetSingleton<JobSystem*>() : nullptr;
+
+		for (std::size_t index = 0; index < m_Layers.size(); ++index)
+		{
+			auto& layer = m_Layers[index];
+			const auto* above = index > 0 ? &m_Layers[index - 1] : nullptr;
+
+			auto compute = [&](std::size_t begin, std::size_t end) {
+				for (auto slot = begin; slot < end; ++slot)
+				{
+					auto& node = layer.Nodes[slot];
+					if (refresh && node.Value)
+						Refresh(entities, node);
+
+					auto dirty = node.Value && (node.Inserted || node.Ticks->Changed > lastRun);
+					dirty = dirty || (node.Parent != NoSlot && above->Dirty[node.Parent] != 0);
+
+					layer.Dirty[slot] = dirty ? 1 : 0;
+					if (!dirty)
+						continue;
+
+					auto matrix = node.Local->Matrix();
+					if (node.Parent != NoSlot)
+						matrix = above->Matrices[node.Parent] * matrix;
+
+					layer.Matrices[slot] = matrix;
+					node.World->Matrix = matrix;
+					node.Inserted = false;
+				}
+			};
+
+			if (jobs == nullptr)
+			{
+				compute(0, layer.Nodes.size());
+				continue;
+			}
+
+			jobs->ParallelRange(layer.Nodes.size(), ChunkSize, compute);
+		}
+	}
+
+	auto TransformSystem::Restructure(EntityManager& entities) -> void
+	{
+		std::ranges::sort(m_Touched);
+		m_Touched.erase(std::ranges::unique(m_Touched).begin(), m_Touched.end());
+
+		// The depth of descendants changes with the depth of their ancestor, so they are removed and inserted again
+		// as well. Only layers below entities with children are scanned for descendants.
+		std::vector<std::vector<std::uint32_t>> removed(m_Layers.size());
+		for (auto entity : m_Touched)
+		{
+			auto location = Find(entity);
+			if (location.Layer != NoSlot)
+				removed[location.Layer].push_back(location.Slot);
+		}
+
+		std::vector<std::uint8_t> marks{};
+		for (std::size_t index = 0; index + 1 < m_Layers.size(); ++index)
+		{
+			auto& layer = m_Layers[index];
+			auto parents = std::ranges::any_of(removed[index], [&](auto slot) {
+				return layer.Nodes[slot].Children > 0;
+			});
+
+			if (!parents)
+				continue;
+
+			marks.assign(layer.Nodes.size(), 0);
+			for (auto slot : removed[index])
+				marks[slot] = 1;
+
+			const auto& below = m_Layers[index + 1].Nodes;
+			for (std::size_t slot = 0; slot < below.size(); ++slot)
+			{
+				if (below[slot].Parent == NoSlot || marks[below[slot].Parent] == 0)
+					continue;
+
+				removed[index + 1].push_back(static_cast<std::uint32_t>(slot));
+				m_Touched.push_back(below[slot].Value);
+			}
+		}
+
+		// Descendants are removed first, so the child counts of their ancestors stay consistent.
+		for (auto index = removed.size(); index-- > 0;)
+		{
+			for (auto slot : removed[index])
+				Remove({static_cast<std::uint32_t>(index), slot});
+		}
+
+		// Ancestors not inserted yet are inserted ahead of their descendants. A chain of ancestors longer than the
+		// number of touched entities can only be caused by a cycle.
+		std::vector<Entity> chain{};
+		for (auto entity : m_Touched)
+		{
+			if (!entities.Valid(entity) || !entities.HasComponent<LocalTransform>(entity))
+				continue;
+
+			if (Find(entity).Layer != NoSlot)
+				continue;
+
+			auto parent = Location{};
+			for (auto node = entity; node;)
+			{
+				chain.push_back(node);
+				if (chain.size() > m_Touched.size())
+					throw EntityException{"Transform hierarchy contains a cycle"};
+
+				if (!entities.HasComponent<Parent>(node))
+					break;
+
+				auto ancestor = entities.GetComponent<Parent>(node).Value;
+				if (!entities.Valid(ancestor) || !entities.HasComponent<LocalTransform>(ancestor))
+					break;
+
+				parent = Find(ancestor);
+				node = parent.Layer == NoSlot ? ancestor : Entity{};
+			}
+
+			for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+				parent = Insert(entities, *it, parent);
+
+			chain.clear();
+		}
+
+		m_Touched.clear();
+		Shrink();
+	}
+
+	auto TransformSystem::Adopt(EntityManager& entities) -> void
+	{
+		std::ranges::sort(m_Orphans);
+		m_Orphans.erase(std::ranges::unique(m_Orphans).begin(), m_Orphans.end());
+
+		// Orphans referencing a parent that gained a local transform are inserted again below it, orphans that were
+		// moved or whose parent was destroyed are forgotten.
+		std::erase_if(m_Orphans, [&](Entity orphan) {
+			auto location = Find(orphan);
+			if (location.Layer == NoSlot || m_Layers[location.Layer].Nodes[location.Slot].Parent != NoSlot ||
+				!entities.HasComponent<Parent>(orphan))
+				return true;
+
+			auto parent = entities.GetComponent<Parent>(orphan).Value;
+			if (!entities.Valid(parent))
+				return true;
+
+			if (!entities.HasComponent<LocalTransform>(parent))
+				return false;
+
+			m_Touched.push_back(orphan);
+			return true;
+		});
+	}
+
+	auto TransformSystem::Insert(EntityManager& entities, Entity entity, Location parent) -> Location
+	{
+		auto index = parent.Layer != NoSlot ? parent.Layer + 1 : 0;
+		if (index == m_Layers.size())
+			m_Layers.emplace_back();
+
+		auto& layer = m_Layers[index];
+		auto slot = static_cast<std::uint32_t>(layer.Nodes.size());
+
+		if (layer.Free.empty())
+		{
+			layer.Nodes.emplace_back();
+			layer.Matrices.emplace_back(1.0F);
+			layer.Dirty.push_back(0);
+		}
+		else
+		{
+			slot = layer.Free.back();
+			layer.Free.pop_back();
+		}
+
+		if (!entities.HasComponent<WorldTransform>(entity))
+			entities.CreateComponent<WorldTransform>(entity);
+
+		auto& node = layer.Nodes[slot];
+		node = {.Value = entity, .Parent = parent.Slot, .Inserted = true};
+		Refresh(entities, node);
+
+		if (parent.Layer != NoSlot)
+			++m_Layers[parent.Layer].Nodes[parent.Slot].Children;
+		else if (entities.HasComponent<Parent>(entity) && entities.GetComponent<Parent>(entity).Value)
+			m_Orphans.push_back(entity);
+
+		auto id = entt::to_entity(entity);
+		if (id >= m_Locations.size())
+			m_Locations.resize(id + 1);
+
+		m_Locations[id] = {static_cast<std::uint32_t>(index), slot};
+		return m_Locations[id];
+	}
+
+	auto TransformSystem::Remove(Location location) -> void
+	{
+		auto& layer = m_Layers[location.Layer];
+		auto& node = layer.Nodes[location.Slot];
+
+		// Slots of descendants may be listed twice, once as touched and once as descendant.
+		if (!node.Value)
+			return;
+
+		if (node.Parent != NoSlot)
+			--m_Layers[location.Layer - 1].Nodes[node.Parent].Children;
+
+		m_Locations[entt::to_entity(node.Value)] = {};
+		node = {};
+		layer.Free.push_back(location.Slot);
+	}
+
+	auto TransformSystem::Shrink() -> void
+	{
+		for (std::size_t index = 0; index < m_Layers.size(); ++index)
+		{
+			auto& layer = m_Layers[index];
+			if (layer.Free.size() * 2 <= layer.Nodes.size())
+				continue;
+
+			std::vector<std::uint32_t> slots(layer.Nodes.size(), NoSlot);
+			std::uint32_t count{};
+
+			for (std::size_t slot = 0; slot < layer.Nodes.size(); ++slot)
+			{
+				if (!layer.Nodes[slot].Value)
+					continue;
+
+				slots[slot] = count;
+				layer.Nodes[count] = layer.Nodes[slot];
+				layer.Matrices[count] = layer.Matrices[slot];
+				m_Locations[entt::to_entity(layer.Nodes[count].Value)].Slot = count;
+				++count;
+			}
+
+			layer.Nodes.resize(count);
+			layer.Matrices.resize(count);
+			layer.Dirty.resize(count);
+			layer.Free.clear();
+
+			if (index + 1 == m_Layers.size())
+				continue;
+
+			for (auto& node : m_Layers[index + 1].Nodes)
+			{
+				if (node.Parent != NoSlot)
+					node.Parent = slots[node.Parent];
+			}
+		}
+
+		while (!m_Layers.empty() && m_Layers.back().Nodes.empty())
+			m_Layers.pop_back();
+	}
+
+	auto TransformSystem::Refresh(EntityManager& entities, Node& node) -> void
+	{
+		node.Local = &entities.GetComponent<LocalTransform>(node.Value);
+		node.Ticks = &entities.GetComponent<ComponentTicks<LocalTransform>>(node.Value);
+		node.World = &entities.GetComponent<WorldTransform>(node.Value);
+	}
+
+	auto TransformSystem::Find(Entity entity) const -> Location
+	{
+		auto id = entt::to_entity(entity);
+		if (id >= m_Locations.size())
+			return {};
+
+		auto location = m_Locations[id];
+		if (location.Layer == NoSlot || m_Layers[location.Layer].Nodes[location.Slot].Value != entity)
+			return {};
+
+		return location;
+	}
+} //namespace Star
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "Starlight/Runtime/Entity.hpp"
+#include "Starlight/Runtime/System.hpp"
+
+#include <glm/gtc/quaternion.hpp>
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Star
+{
+	/// @brief Parent of an entity in the transform hierarchy.
+	struct Parent
+	{
+		/// @brief Parent entity handle, entities without a local transform are treated as absent.
+		Entity Value{};
+	};
+
+	/// @brief Transform relative to the parent, or to the world for entities without a parent.
+	/// @details Changes are only picked up when made through tracked paths, such as @c PatchComponent or
+	/// @c MarkChanged.
+	struct LocalTransform
+	{
+		/// @brief Translation.
+		glm::vec3 Position{};
+
+		/// @brief Rotation.
+		glm::quat Rotation{1.0F, 0.0F, 0.0F, 0.0F};
+
+		/// @brief Scale along each axis.
+		glm::vec3 Scale{1.0F};
+
+		/// @brief Record change ticks so only changed subtrees are recomputed.
+		static constexpr bool Tracked = true;
+
+		/// @brief Compose the transform into a matrix.
+		/// @return Matrix scaling, rotating and then translating.
+		[[nodiscard]] auto Matrix() const -> glm::mat4;
+	};
+
+	/// @brief Transform relative to the world, computed by the transform system.
+	struct WorldTransform
+	{
+		/// @brief Matrix transforming from the local space of the entity into world space.
+		glm::mat4 Matrix{1.0F};
+	};
+
+	/// @brief System computing world transforms of all entities with a local transform.
+	/// @details Entities are kept in one array per depth in the hierarchy, so world matrices are computed layer by
+	/// layer with every parent ahead of its children. Entities of the same depth are computed concurrently on the job
+	/// system published in the entity manager. Only entities whose local transform changed since the system last
+	/// ran, and their descendants, are recomputed.
+	///
+	/// Every array entry keeps the index of its parent in the layer above and pointers to the components of its
+	/// entity, so computing an entity does not look up any component. Entities whose local transform or parent is
+	/// created, replaced or destroyed are removed from their layer together with their descendants and inserted
+	/// again at their new depth, reusing free entries, which also creates missing world transforms. Layers are
+	/// compacted once more than half of their entries are free. Component pointers are refreshed while computing
+	/// after local or world transforms are destroyed, since destroying a component moves another into its place.
+	/// Local and world transforms must therefore not be owned by groups or sorted.
+	class TransformSystem : public System
+	{
+	public:
+		/// @brief Update in the root of the system manager.
+		using UpdateIn = SystemManager;
+
+		/// @brief Components read by the system.
+		using Reads = ComponentList<Parent, LocalTransform>;
+
+		/// @brief Components written by the system.
+		using Writes = ComponentList<WorldTransform>;
+
+		/// @brief Number of entities per chunk computed on a worker thread.
+		static constexpr std::size_t ChunkSize = 1024;
+
+		auto Initialize(EntityManager& entities) -> void override;
+
+		auto Update(EntityManager& entities) -> void override;
+
+	private:
+		static constexpr auto NoSlot = ~std::uint32_t{};
+
+		struct Node
+		{
+			Entity Value{};
+			std::uint32_t Parent{NoSlot};
+			std::uint32_t Children{};
+			const LocalTransform* Local{};
+			const ComponentTicks<LocalTransform>* Ticks{};
+			WorldTransform* World{};
+			bool Inserted{};
+		};
+
+		struct Layer
+		{
+			std::vector<Node> Nodes{};
+			std::vector<glm::mat4> Matrices{};
+			std::vector<std::uint8_t> Dirty{};
+			std::vector<std::uint32_t> Free{};
+		};
+
+		struct Location
+		{
+			std::uint32_t Layer{NoSlot};
+			std::uint32_t Slot{NoSlot};
+		};
+
+		auto Restructure(EntityManager& entities) -> void;
+
+		auto Adopt(EntityManager& entities) -> void;
+
+		auto Insert(EntityManager& entities, Entity entity, Location parent) -> Location;
+
+		auto Remove(Location location) -> void;
+
+		auto Shrink() -> void;
+
+		static auto Refresh(EntityManager& entities, Node& node) -> void;
+
+		[[nodiscard]] auto Find(Entity entity) const -> Location;
+
+		std::array<EntityObserver*, 6> m_Observers{};
+		std::vector<Layer> m_Layers{};
+		std::vector<Location> m_Locations{};
+		std::vector<Entity> m_Orphans{};
+		std::vector<Entity> m_Touched{};
+		bool m_Built{};
+	};
+} //namespace Star
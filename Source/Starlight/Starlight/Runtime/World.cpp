@@ -0,0 +1,82 @@
+#include "World.hpp"
+
+#include "Starlight/Runtime/Command.hpp"
+#include "Starlight/Runtime/Input.hpp"
+#include "Starlight/Runtime/Time.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace
+{
+	/// Weight of the latest update in the moving average, roughly covering the last second at 60 updates per second.
+	constexpr auto AverageWeight = 1.0 / 60.0;
+} //namespace
+
+namespace Star
+{
+	World::World(JobSystem& jobs, FrameAllocator* frames) :
+		m_Jobs{&jobs}
+	{
+		m_Entities.CreateSingleton<JobSystem*>(m_Jobs);
+		m_Entities.CreateSingleton<Time>();
+		m_Entities.CreateSingleton<CommandQueue>(m_Jobs);
+		m_Entities.CreateSingleton<InputState>();
+
+		if (frames != nullptr)
+			m_Entities.CreateSingleton<FrameAllocator*>(frames);
+	}
+
+	auto World::Update(double delta) -> void
+	{
+		auto begin = std::chrono::steady_clock::now();
+
+		auto& time = m_Entities.GetSingleton<Time>();
+		time.FrameDelta = std::min(delta, Time::MaxFrameDelta);
+		time.Delta = time.FrameDelta;
+		time.Elapsed += time.FrameDelta;
+
+		m_Systems.Update(m_Entities);
+
+		++time.Frame;
+		m_Entities.GetSingleton<InputState>().Advance();
+
+		auto duration = std::chrono::duration<double>{std::chrono::steady_clock::now() - begin}.count();
+		m_Stats.UpdateTime = duration;
+		m_Stats.AverageUpdateTime =
+			m_Stats.Updates != 0 ? std::lerp(m_Stats.AverageUpdateTime, duration, AverageWeight) : duration;
+		m_Stats.PeakUpdateTime = std::max(m_Stats.PeakUpdateTime, duration);
+		++m_Stats.Updates;
+	}
+
+	auto World::Jobs() const -> JobSystem&
+	{
+		return *m_Jobs;
+	}
+
+	auto World::Entities() -> EntityManager&
+	{
+		return m_Entities;
+	}
+
+	auto World::Entities() const -> const EntityManager&
+	{
+		return m_Entities;
+	}
+
+	auto World::Systems() -> SystemManager&
+	{
+		return m_Systems;
+	}
+
+	auto World::Systems() const -> const SystemManager&
+	{
+		return m_Systems;
+	}
+
+	auto World::Stats() const -> const WorldStats&
+	{
+		return m_Stats;
+	}
+} //namespace Star
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "Starlight/Runtime/Entity.hpp"
+#include "Starlight/Runtime/Job.hpp"
+#include "Starlight/Runtime/Memory.hpp"
+#include "Starlight/Runtime/System.hpp"
+
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Star
+{
+	/// @brief Update statistics of a world.
+	struct WorldStats
+	{
+		/// @brief Duration in seconds of the latest update.
+		double UpdateTime{};
+
+		/// @brief Exponential moving average of the update duration in seconds.
+		double AverageUpdateTime{};
+
+		/// @brief Longest update duration in seconds.
+		double PeakUpdateTime{};
+
+		/// @brief Number of updates.
+		std::uint64_t Updates{};
+	};
+
+	/// @brief Independent simulation with its own entities and systems.
+	/// @details The job system is published to the entity manager as a @c JobSystem* singleton, the frame timing as a
+	/// @c Time singleton, per-thread command buffers as a @c CommandQueue singleton and the input state as an
+	/// @c InputState singleton. A frame allocator, if any, is published as a @c FrameAllocator* singleton.
+	class World
+	{
+	public:
+		/// @brief Create a world.
+		/// @param jobs Job system updating the systems of the world.
+		/// @param frames Frame allocator providing scratch memory to the systems of the world.
+		explicit World(JobSystem& jobs, FrameAllocator* frames = nullptr);
+
+		/// @brief Copy constructor.
+		/// @param other World to copy from.
+		World(const World& other) = delete;
+
+		/// @brief Move constructor.
+		/// @param other World to move from.
+		World(World&& other) = delete;
+
+		/// @brief Copy operator.
+		/// @param other World to copy from.
+		/// @return Reference to the current world.
+		auto operator=(const World& other) -> World& = delete;
+
+		/// @brief Move operator.
+		/// @param other World to move from.
+		/// @return Reference to the current world.
+		auto operator=(World&& other) -> World& = delete;
+
+		/// @brief Destructor.
+		~World() = default;
+
+		/// @brief Advance the world by a frame.
+		/// @param delta Frame duration in seconds.
+		auto Update(double delta) -> void;
+
+		/// @brief Move entities into another world.
+		/// @details Entities are created in the target world and destroyed in this one as a single range each, and
+		/// every listed component type is inserted into its target storage as a single range. Components of types
+		/// that are not listed are not moved, they are destroyed together with the entities in this world. Neither
+		/// world may be updating.
+		/// @tparam TComponents Component types to move.
+		/// @param components Component types to move.
+		/// @param entities Valid entity handles of this world.
+		/// @param target World to move the entities to.
+		/// @return Entity handles in the target world, in the order of @c entities.
+		template <typename... TComponents>
+		auto MoveEntities(
+			[[maybe_unused]] ComponentList<TComponents...> components,
+			std::span<const Entity> entities,
+			World& target
+		) -> std::vector<Entity>
+		{
+			std::vector<Entity> moved(entities.size());
+			target.m_Entities.CreateMany(moved);
+
+			(MoveComponents<TComponents>(entities, moved, target.m_Entities), ...);
+
+			m_Entities.DestroyMany(entities);
+			return moved;
+		}
+
+		/// @brief Get the job system.
+		/// @return A reference to the job system.
+		[[nodiscard]] auto Jobs() const -> JobSystem&;
+
+		/// @brief Get the entity manager.
+		/// @return A reference to the entity manager.
+		[[nodiscard]] auto Entities() -> EntityManager&;
+
+		/// @brief Get the entity manager.
+		/// @return A reference to the entity manager.
+		[[nodiscard]] auto Entities() const -> const EntityManager&;
+
+		/// @brief Get the system manager.
+		/// @return A reference to the system manager.
+		[[nodiscard]] auto Systems() -> SystemManager&;
+
+		/// @brief Get the system manager.
+		/// @return A reference to the system manager.
+		[[nodiscard]] auto Systems() const -> const SystemManager&;
+
+		/// @brief Get the update statistics.
+		/// @return A reference to the statistics.
+		[[nodiscard]] auto Stats() const -> const WorldStats&;
+
+	private:
+		template <typename TType>
+		auto MoveComponents(std::span<const Entity> entities, std::span<const Entity> moved, EntityManager& target)
+			-> void
+		{
+			std::vector<Entity> owners{};
+			std::vector<TType> components{};
+
+			for (std::size_t i = 0; i < entities.size(); ++i)
+			{
+				if (!m_Entities.HasComponent<TType>(entities[i]))
+					continue;
+
+				owners.push_back(moved[i]);
+				if constexpr (!std::is_empty_v<TType>)
+					components.push_back(std::move(m_Entities.GetComponent<TType>(entities[i])));
+			}
+
+			if constexpr (std::is_empty_v<TType>)
+				target.CreateComponents<TType>(owners);
+			else
+				target.CreateComponents<TType>(owners, components);
+		}
+
+		JobSystem* m_Jobs{};
+		EntityManager m_Entities{};
+		SystemManager m_Systems{};
+		WorldStats m_Stats{};
+	};
+} //namespace Star
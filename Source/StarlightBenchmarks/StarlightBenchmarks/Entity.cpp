@@ -0,0 +1,277 @@
+#include "Starlight/Runtime/Entity.hpp"
+
+#include <benchmark/benchmark.h>
+#include <glm/vec3.hpp>
+
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	using namespace Star;
+
+	struct Position
+	{
+		float X{};
+		float Y{};
+		float Z{};
+	};
+
+	struct Velocity
+	{
+		float X{};
+		float Y{};
+		float Z{};
+	};
+
+	struct Mass
+	{
+		float Value{};
+	};
+
+	struct Body
+	{
+		glm::vec3 Position{};
+		glm::vec3 Velocity{};
+
+		using Lanes = LaneList<&Body::Position, &Body::Velocity>;
+	};
+
+	auto EntityCreate(benchmark::State& state) -> void
+	{
+		EntityManager entities{};
+		std::vector<Entity> created(static_cast<std::size_t>(state.range(0)));
+
+		for ([[maybe_unused]] auto iteration : state)
+		{
+			for (auto& entity : created)
+				entity = entities.Create();
+
+			state.PauseTiming();
+			for (auto entity : created)
+				entities.Destroy(entity);
+			state.ResumeTiming();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	auto EntityDestroy(benchmark::State& state) -> void
+	{
+		EntityManager entities{};
+		std::vector<Entity> created(static_cast<std::size_t>(state.range(0)));
+
+		for ([[maybe_unused]] auto iteration : state)
+		{
+			state.PauseTiming();
+			for (auto& entity : created)
+			{
+				entity = entities.Create();
+				entities.CreateComponent<Position>(entity);
+			}
+			state.ResumeTiming();
+
+			for (auto entity : created)
+				entities.Destroy(entity);
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	auto EntityCreateComponent(benchmark::State& state) -> void
+	{
+		EntityManager entities{};
+		std::vector<Entity> created(static_cast<std::size_t>(state.range(0)));
+
+		for (auto& entity : created)
+			entity = entities.Create();
+
+		for ([[maybe_unused]] auto iteration : state)
+		{
+			for (auto entity : created)
+				entities.CreateComponent<Position>(entity, 1.0F, 2.0F, 3.0F);
+
+			state.PauseTiming();
+			entities.ClearComponent<Position>();
+			state.ResumeTiming();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	auto EntitySpawnPrefab(benchmark::State& state) -> void
+	{
+		EntityManager entities{};
+		std::vector<Entity> created(static_cast<std::size_t>(state.range(0)));
+
+		Prefab prefab{};
+		prefab.Add<Position>().Add<Velocity>(1.0F, 2.0F, 3.0F).Add<Mass>(1.0F);
+
+		for ([[maybe_unused]] auto iteration : state)
+		{
+			entities.CreateMany(prefab, created);
+
+			state.PauseTiming();
+			entities.DestroyMany(created);
+			state.ResumeTiming();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	auto EntityDestroyMany(benchmark::State& state) -> void
+	{
+		EntityManager entities{};
+		std::vector<Entity> created(static_cast<std::size_t>(state.range(0)));
+
+		Prefab prefab{};
+		prefab.Add<Position>();
+
+		for ([[maybe_unused]] auto iteration : state)
+		{
+			state.PauseTiming();
+			entities.CreateMany(prefab, created);
+			state.ResumeTiming();
+
+			entities.DestroyMany(created);
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	/// Renumbers and compacts the survivors after destroying the first nine tenths of the entities.
+	auto EntityCompact(benchmark::State& state) -> void
+	{
+		auto count = static_cast<std::size_t>(state.range(0));
+
+		Prefab prefab{};
+		prefab.Add<Position>();
+		prefab.Add<Velocity>();
+
+		for ([[maybe_unused]] auto iteration : state)
+		{
+			state.PauseTiming();
+			EntityManager entities{};
+			auto created = entities.CreateMany(prefab, count);
+			entities.DestroyMany(std::span{created}.first(count - count / 10));
+			state.ResumeTiming();
+
+			benchmark::DoNotOptimize(entities.Renumber(ComponentList<Position, Velocity>{}));
+			entities.Compact();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0) / 10);
+	}
+
+	auto EntityViewIteration(benchmark::State& state) -> void
+	{
+		EntityManager entities{};
+
+		// Every other entity has a mass, so the view has to skip half of the candidates.
+		for (std::int64_t i = 0; i < state.range(0); ++i)
+		{
+			auto entity = entities.Create();
+			entities.CreateComponent<Position>(entity);
+			entities.CreateComponent<Velocity>(entity, 1.0F, 1.0F, 1.0F);
+
+			if (i % 2 == 0)
+				entities.CreateComponent<Mass>(entity, 1.0F);
+		}
+
+		auto view = entities.View(ComponentList<Position, const Velocity, const Mass>{}, ComponentList<>{});
+
+		for ([[maybe_unused]] auto iteration : state)
+		{
+			for (auto entity : view)
+			{
+				auto& position = view.Get<Position>(entity);
+				const auto& velocity = view.Get<const Velocity>(entity);
+				const auto& mass = view.Get<const Mass>(entity);
+
+				position.X += velocity.X / mass.Value;
+				position.Y += velocity.Y / mass.Value;
+				position.Z += velocity.Z / mass.Value;
+			}
+
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	auto EntityGroupIteration(benchmark::State& state) -> void
+	{
+		EntityManager entities{};
+
+		// Same population as the view benchmark, with positions and velocities packed in lock-step by the group.
+		auto group =
+			entities.Group(ComponentList<Position, Velocity>{}, ComponentList<const Mass>{}, ComponentList<>{});
+
+		for (std::int64_t i = 0; i < state.range(0); ++i)
+		{
+			auto entity = entities.Create();
+			entities.CreateComponent<Position>(entity);
+			entities.CreateComponent<Velocity>(entity, 1.0F, 1.0F, 1.0F);
+
+			if (i % 2 == 0)
+				entities.CreateComponent<Mass>(entity, 1.0F);
+		}
+
+		for ([[maybe_unused]] auto iteration : state)
+		{
+			group.Each([](Entity, Position& position, const Velocity& velocity, const Mass& mass) {
+				position.X += velocity.X / mass.Value;
+				position.Y += velocity.Y / mass.Value;
+				position.Z += velocity.Z / mass.Value;
+			});
+
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	auto EntityLaneIteration(benchmark::State& state) -> void
+	{
+		EntityManager entities{};
+
+		for (std::int64_t i = 0; i < state.range(0); ++i)
+			entities.CreateComponent<Body>(entities.Create(), glm::vec3{}, glm::vec3{1.0F, 1.0F, 1.0F});
+
+		auto& bodies = entities.Lanes<Body>();
+
+		for ([[maybe_unused]] auto iteration : state)
+		{
+			// Lanes are padded to the SIMD width, so the loops vectorize without a scalar remainder.
+			[&]<std::size_t... TLanes>(std::index_sequence<TLanes...>) {
+				(
+					[&] {
+						auto positions = bodies.Lane<0, TLanes>();
+						auto velocities = bodies.Lane<1, TLanes>();
+
+						for (std::size_t index = 0; index < positions.size(); ++index)
+							positions[index] += velocities[index];
+					}(),
+					...
+				);
+			}(std::make_index_sequence<3>{});
+
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+} //namespace
+
+// NOLINTBEGIN(*-magic-numbers)
+BENCHMARK(EntityCreate)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+BENCHMARK(EntityDestroy)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+BENCHMARK(EntityCreateComponent)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+BENCHMARK(EntitySpawnPrefab)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+BENCHMARK(EntityDestroyMany)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+BENCHMARK(EntityCompact)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+BENCHMARK(EntityViewIteration)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+BENCHMARK(EntityGroupIteration)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+BENCHMARK(EntityLaneIteration)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+// NOLINTEND(*-magic-numbers)
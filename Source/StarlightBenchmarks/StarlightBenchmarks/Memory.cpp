@@ -0,0 +1,63 @@
+#include "Starlight/Runtime/Memory.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace
+{
+	using namespace Star;
+
+	constexpr std::size_t ScratchCount = 64;
+
+	/// Fills 64 scratch vectors per frame from the global heap.
+	auto HeapScratch(benchmark::State& state) -> void
+	{
+		auto size = static_cast<std::size_t>(state.range(0));
+
+		for ([[maybe_unused]] auto iteration : state)
+		{
+			for (std::size_t i = 0; i < ScratchCount; ++i)
+			{
+				std::vector<std::uint32_t> scratch{};
+				for (std::size_t j = 0; j < size; ++j)
+					scratch.push_back(static_cast<std::uint32_t>(j));
+
+				benchmark::DoNotOptimize(scratch.data());
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ScratchCount));
+	}
+
+	/// Fills 64 scratch vectors per frame from a frame arena reset after every frame.
+	auto FrameArenaScratch(benchmark::State& state) -> void
+	{
+		auto size = static_cast<std::size_t>(state.range(0));
+		FrameArena arena{};
+
+		for ([[maybe_unused]] auto iteration : state)
+		{
+			for (std::size_t i = 0; i < ScratchCount; ++i)
+			{
+				std::pmr::vector<std::uint32_t> scratch{&arena};
+				for (std::size_t j = 0; j < size; ++j)
+					scratch.push_back(static_cast<std::uint32_t>(j));
+
+				benchmark::DoNotOptimize(scratch.data());
+			}
+
+			arena.Reset();
+		}
+
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ScratchCount));
+	}
+} //namespace
+
+// NOLINTBEGIN(*-magic-numbers)
+BENCHMARK(HeapScratch)->RangeMultiplier(8)->Range(8, 4096);
+BENCHMARK(FrameArenaScratch)->RangeMultiplier(8)->Range(8, 4096);
+// NOLINTEND(*-magic-numbers)
@@ -0,0 +1,73 @@
+#include "Starlight/Runtime/Snapshot.hpp"
+#include "Starlight/Runtime/Transform.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <vector>
+
+namespace
+{
+	using namespace Star;
+
+	using Stored = ComponentList<LocalTransform, WorldTransform>;
+
+	[[nodiscard]] auto SnapshotPath() -> std::filesystem::path
+	{
+		return std::filesystem::temp_directory_path() / "StarlightBenchmarks.snapshot";
+	}
+
+	auto Populate(EntityManager& entities, std::size_t count) -> void
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			auto entity = entities.Create();
+			entities.CreateComponent<LocalTransform>(entity).Position.x = static_cast<float>(i);
+			entities.CreateComponent<WorldTransform>(entity);
+		}
+	}
+
+	/// Rebuilds a world entity by entity, as a baseline for restoring it from a snapshot.
+	auto SnapshotRebuild(benchmark::State& state) -> void
+	{
+		auto count = static_cast<std::size_t>(state.range(0));
+
+		for ([[maybe_unused]] auto iteration : state)
+		{
+			EntityManager entities{};
+			Populate(entities, count);
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	/// Restores a world from a mapped snapshot with bulk inserts.
+	auto SnapshotRestore(benchmark::State& state) -> void
+	{
+		{
+			EntityManager entities{};
+			Populate(entities, static_cast<std::size_t>(state.range(0)));
+
+			SnapshotWriter writer{};
+			writer.Add(entities, Stored{});
+			writer.Save(SnapshotPath());
+		}
+
+		SnapshotFile file{SnapshotPath()};
+
+		for ([[maybe_unused]] auto iteration : state)
+		{
+			EntityManager entities{};
+			SnapshotLoader loader{file, entities};
+			loader.Load(Stored{});
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+} //namespace
+
+// NOLINTBEGIN(*-magic-numbers)
+BENCHMARK(SnapshotRebuild)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+BENCHMARK(SnapshotRestore)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+// NOLINTEND(*-magic-numbers)
@@ -0,0 +1,148 @@
+#include "Starlight/Runtime/Job.hpp"
+#include "Starlight/Runtime/Spatial.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+	using namespace Star;
+
+	constexpr std::size_t GridSize = 100;
+	constexpr std::size_t MovingStride = 10;
+	constexpr std::size_t ChurnStride = 100;
+	constexpr std::size_t QueryCount = 1024;
+
+	/// Lays out unit boxes on a grid of 100 by 100 columns.
+	[[nodiscard]] auto GridBounds(std::size_t index) -> Bounds
+	{
+		glm::vec3 min{
+			static_cast<float>(index % GridSize) * 2.0F,
+			static_cast<float>(index / GridSize % GridSize) * 2.0F,
+			static_cast<float>(index / (GridSize * GridSize)) * 2.0F,
+		};
+
+		return {min, min + glm::vec3{1.0F}};
+	}
+
+	/// Moves every tenth box before each update, which refits the hierarchy unless it degraded too far.
+	auto SpatialUpdate(benchmark::State& state) -> void
+	{
+		EntityManager entities{};
+
+		std::vector<Entity> boxes(static_cast<std::size_t>(state.range(0)));
+		for (std::size_t i = 0; i < boxes.size(); ++i)
+		{
+			boxes[i] = entities.Create();
+			entities.CreateComponent<Bounds>(boxes[i], GridBounds(i));
+		}
+
+		// The first update builds the hierarchy.
+		SpatialSystem system{};
+		system.Initialize(entities);
+		system.Update(entities);
+
+		for ([[maybe_unused]] auto iteration : state)
+		{
+			state.PauseTiming();
+			auto tick = entities.AdvanceChangeTick();
+			for (std::size_t i = 0; i < boxes.size(); i += MovingStride)
+			{
+				auto& bounds = entities.PatchComponent<Bounds>(boxes[i]);
+				bounds.Min.x += 0.1F;
+				bounds.Max.x += 0.1F;
+			}
+
+			EntityManager::LastRunTick(tick - 1);
+			state.ResumeTiming();
+
+			system.Update(entities);
+		}
+
+		EntityManager::LastRunTick(0);
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	/// Destroys and recreates the bounds of every hundredth box before each update, which inserts into and removes
+	/// from the hierarchy.
+	auto SpatialChurn(benchmark::State& state) -> void
+	{
+		EntityManager entities{};
+
+		std::vector<Entity> boxes(static_cast<std::size_t>(state.range(0)));
+		for (std::size_t i = 0; i < boxes.size(); ++i)
+		{
+			boxes[i] = entities.Create();
+			entities.CreateComponent<Bounds>(boxes[i], GridBounds(i));
+		}
+
+		SpatialSystem system{};
+		system.Initialize(entities);
+		system.Update(entities);
+
+		for ([[maybe_unused]] auto iteration : state)
+		{
+			state.PauseTiming();
+			auto tick = entities.AdvanceChangeTick();
+			for (std::size_t i = 0; i < boxes.size(); i += ChurnStride)
+			{
+				entities.Destroy(boxes[i]);
+				boxes[i] = entities.Create();
+				entities.CreateComponent<Bounds>(boxes[i], GridBounds(i));
+			}
+
+			EntityManager::LastRunTick(tick - 1);
+			state.ResumeTiming();
+
+			system.Update(entities);
+		}
+
+		EntityManager::LastRunTick(0);
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	/// Runs a batch of overlap queries spread across the grid on the job system.
+	auto SpatialParallelOverlap(benchmark::State& state) -> void
+	{
+		JobSystem jobs{};
+		SpatialIndex index{};
+
+		std::vector<Entity> handles(static_cast<std::size_t>(state.range(0)));
+		std::vector<Bounds> bounds(handles.size());
+		for (std::size_t i = 0; i < handles.size(); ++i)
+		{
+			handles[i] = static_cast<Entity>(i);
+			bounds[i] = GridBounds(i);
+		}
+
+		index.Build(handles, bounds);
+
+		std::vector<Bounds> queries(QueryCount);
+		for (std::size_t i = 0; i < queries.size(); ++i)
+		{
+			queries[i] = GridBounds(i * handles.size() / queries.size());
+			queries[i].Max += glm::vec3{2.0F};
+		}
+
+		std::atomic<std::size_t> hits{};
+		auto count = [&]([[maybe_unused]] std::size_t query, [[maybe_unused]] Entity entity) {
+			hits.fetch_add(1, std::memory_order_relaxed);
+		};
+
+		for ([[maybe_unused]] auto iteration : state)
+			index.ParallelOverlap(jobs, queries, count);
+
+		benchmark::DoNotOptimize(hits.load());
+		state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(queries.size()));
+	}
+} //namespace
+
+// NOLINTBEGIN(*-magic-numbers)
+BENCHMARK(SpatialUpdate)->RangeMultiplier(10)->Range(10'000, 1'000'000)->UseRealTime();
+BENCHMARK(SpatialChurn)->RangeMultiplier(10)->Range(10'000, 1'000'000)->UseRealTime();
+BENCHMARK(SpatialParallelOverlap)->RangeMultiplier(10)->Range(10'000, 1'000'000)->UseRealTime();
+// NOLINTEND(*-magic-numbers)
@@ -0,0 +1,73 @@
+#include "Starlight/Runtime/Job.hpp"
+#include "Starlight/Runtime/System.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <utility>
+
+namespace
+{
+	using namespace Star;
+
+	constexpr std::size_t MaxSystems = 1000;
+
+	template <std::size_t TIndex>
+	struct Counter
+	{
+		std::size_t Value{};
+	};
+
+	/// Declares no component access, so every system gets a stage of its own.
+	template <std::size_t TIndex>
+	struct ExclusiveSystem : System
+	{
+		auto Update([[maybe_unused]] EntityManager& entities) -> void override
+		{
+			benchmark::DoNotOptimize(this);
+		}
+	};
+
+	/// Writes a component of its own, so all systems share a single stage.
+	template <std::size_t TIndex>
+	struct IndependentSystem : System
+	{
+		using Writes = ComponentList<Counter<TIndex>>;
+
+		auto Update([[maybe_unused]] EntityManager& entities) -> void override
+		{
+			benchmark::DoNotOptimize(this);
+		}
+	};
+
+	template <template <std::size_t> typename TSystem, std::size_t... TIndices>
+	auto CreateSystems(SystemGroup& group, std::size_t count, [[maybe_unused]] std::index_sequence<TIndices...> indices)
+		-> void
+	{
+		((TIndices < count ? static_cast<void>(group.CreateSystem<TSystem<TIndices>>()) : void()), ...);
+	}
+
+	template <template <std::size_t> typename TSystem>
+	auto SystemDispatch(benchmark::State& state) -> void
+	{
+		JobSystem jobs{};
+		EntityManager entities{};
+		entities.CreateSingleton<JobSystem*>(&jobs);
+
+		SystemGroup group{};
+		CreateSystems<TSystem>(group, static_cast<std::size_t>(state.range(0)), std::make_index_sequence<MaxSystems>{});
+
+		// The first update compiles the execution plan.
+		group.Update(entities);
+
+		for ([[maybe_unused]] auto iteration : state)
+			group.Update(entities);
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+} //namespace
+
+// NOLINTBEGIN(*-magic-numbers)
+BENCHMARK_TEMPLATE(SystemDispatch, ExclusiveSystem)->RangeMultiplier(10)->Range(10, MaxSystems);
+BENCHMARK_TEMPLATE(SystemDispatch, IndependentSystem)->RangeMultiplier(10)->Range(10, MaxSystems);
+// NOLINTEND(*-magic-numbers)
@@ -0,0 +1,104 @@
+#include "Starlight/Runtime/Job.hpp"
+#include "Starlight/Runtime/Transform.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+	using namespace Star;
+
+	constexpr std::size_t Fanout = 8;
+	constexpr std::size_t AnimatedStride = 10;
+	constexpr std::size_t ChurnStride = 100;
+
+	/// Builds a forest of trees with a fanout of 8, then animates every tenth node before each update.
+	auto TransformUpdate(benchmark::State& state) -> void
+	{
+		JobSystem jobs{};
+		EntityManager entities{};
+		entities.CreateSingleton<JobSystem*>(&jobs);
+
+		std::vector<Entity> nodes(static_cast<std::size_t>(state.range(0)));
+		for (std::size_t i = 0; i < nodes.size(); ++i)
+		{
+			nodes[i] = entities.Create();
+			entities.CreateComponent<LocalTransform>(nodes[i]);
+
+			if (i >= Fanout)
+				entities.CreateComponent<Parent>(nodes[i], nodes[i / Fanout - 1]);
+		}
+
+		// The first update builds the depth sorted array.
+		TransformSystem system{};
+		system.Initialize(entities);
+		system.Update(entities);
+
+		for ([[maybe_unused]] auto iteration : state)
+		{
+			state.PauseTiming();
+			auto tick = entities.AdvanceChangeTick();
+			for (std::size_t i = 0; i < nodes.size(); i += AnimatedStride)
+				entities.PatchComponent<LocalTransform>(nodes[i]).Position.x += 1.0F;
+
+			EntityManager::LastRunTick(tick - 1);
+			state.ResumeTiming();
+
+			system.Update(entities);
+		}
+
+		EntityManager::LastRunTick(0);
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	/// Builds the same forest, then destroys and recreates every hundredth leaf before each update.
+	auto TransformChurn(benchmark::State& state) -> void
+	{
+		JobSystem jobs{};
+		EntityManager entities{};
+		entities.CreateSingleton<JobSystem*>(&jobs);
+
+		std::vector<Entity> nodes(static_cast<std::size_t>(state.range(0)));
+		for (std::size_t i = 0; i < nodes.size(); ++i)
+		{
+			nodes[i] = entities.Create();
+			entities.CreateComponent<LocalTransform>(nodes[i]);
+
+			if (i >= Fanout)
+				entities.CreateComponent<Parent>(nodes[i], nodes[i / Fanout - 1]);
+		}
+
+		TransformSystem system{};
+		system.Initialize(entities);
+		system.Update(entities);
+
+		for ([[maybe_unused]] auto iteration : state)
+		{
+			state.PauseTiming();
+			auto tick = entities.AdvanceChangeTick();
+			for (auto i = nodes.size() / Fanout; i < nodes.size(); i += ChurnStride)
+			{
+				entities.Destroy(nodes[i]);
+				nodes[i] = entities.Create();
+				entities.CreateComponent<LocalTransform>(nodes[i]);
+				entities.CreateComponent<Parent>(nodes[i], nodes[i / Fanout - 1]);
+			}
+
+			EntityManager::LastRunTick(tick - 1);
+			state.ResumeTiming();
+
+			system.Update(entities);
+		}
+
+		EntityManager::LastRunTick(0);
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+} //namespace
+
+// NOLINTBEGIN(*-magic-numbers)
+BENCHMARK(TransformUpdate)->RangeMultiplier(10)->Range(10'000, 1'000'000)->UseRealTime();
+BENCHMARK(TransformChurn)->RangeMultiplier(10)->Range(10'000, 1'000'000)->UseRealTime();
+// NOLINTEND(*-magic-numbers)
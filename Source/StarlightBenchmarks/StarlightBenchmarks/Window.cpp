@@ -0,0 +1,120 @@
+#include "Starlight/Platform/Window.hpp"
+
+#include <SDL2/SDL.h>
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <optional>
+
+namespace
+{
+	using namespace Star;
+
+	struct Listener : IInputListener, ITextListener
+	{
+		auto OnEvent([[maybe_unused]] Window* sender, const KeyboardEventArgs& event) -> void override
+		{
+			benchmark::DoNotOptimize(event);
+		}
+
+		auto OnEvent([[maybe_unused]] Window* sender, const MouseButtonEventArgs& event) -> void override
+		{
+			benchmark::DoNotOptimize(event);
+		}
+
+		auto OnEvent([[maybe_unused]] Window* sender, const MouseMotionEventArgs& event) -> void override
+		{
+			benchmark::DoNotOptimize(event);
+		}
+
+		auto OnEvent([[maybe_unused]] Window* sender, const MouseScrollEventArgs& event) -> void override
+		{
+			benchmark::DoNotOptimize(event);
+		}
+
+		auto OnEvent([[maybe_unused]] Window* sender, const TextInputEventArgs& event) -> void override
+		{
+			benchmark::DoNotOptimize(event);
+		}
+	};
+
+	/// Window created on the dummy video driver, so the benchmarks run without a display.
+	class Fixture : public benchmark::Fixture
+	{
+	public:
+		auto SetUp([[maybe_unused]] benchmark::State& state) -> void override
+		{
+			SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+			if (SDL_Init(SDL_INIT_VIDEO) < 0)
+			{
+				state.SkipWithError(SDL_GetError());
+				return;
+			}
+
+			// NOLINTNEXTLINE(*-magic-numbers)
+			m_Window.emplace("Benchmark", glm::ivec2{640, 480}, 0);
+			m_Window->InputListener(&m_Listener);
+			m_Window->TextListener(&m_Listener);
+		}
+
+		auto TearDown([[maybe_unused]] benchmark::State& state) -> void override
+		{
+			m_Window.reset();
+			SDL_Quit();
+		}
+
+		[[nodiscard]] auto WindowId() const -> Uint32
+		{
+			return SDL_GetWindowID(m_Window->Handle());
+		}
+
+	private:
+		Listener m_Listener{};
+		std::optional<Window> m_Window{};
+	};
+} //namespace
+
+BENCHMARK_DEFINE_F(Fixture, WindowKeyboardEvent)(benchmark::State& state)
+{
+	SDL_KeyboardEvent event{};
+	event.type = SDL_KEYDOWN;
+	event.windowID = WindowId();
+	event.state = SDL_PRESSED;
+	event.keysym.scancode = SDL_SCANCODE_W;
+
+	for ([[maybe_unused]] auto iteration : state)
+		Window::HandleEvent(event);
+
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_DEFINE_F(Fixture, WindowMouseMotionEvent)(benchmark::State& state)
+{
+	SDL_MouseMotionEvent event{};
+	event.type = SDL_MOUSEMOTION;
+	event.windowID = WindowId();
+	event.xrel = 1;
+	event.yrel = 1;
+
+	for ([[maybe_unused]] auto iteration : state)
+		Window::HandleEvent(event);
+
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_DEFINE_F(Fixture, WindowTextInputEvent)(benchmark::State& state)
+{
+	SDL_TextInputEvent event{};
+	event.type = SDL_TEXTINPUT;
+	event.windowID = WindowId();
+	std::strncpy(static_cast<char*>(event.text), "Starlight", sizeof(event.text) - 1);
+
+	for ([[maybe_unused]] auto iteration : state)
+		Window::HandleEvent(event);
+
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_REGISTER_F(Fixture, WindowKeyboardEvent);
+BENCHMARK_REGISTER_F(Fixture, WindowMouseMotionEvent);
+BENCHMARK_REGISTER_F(Fixture, WindowTextInputEvent);